@@ -3,42 +3,52 @@
 
 /**
  * Edge.h
- * 
+ *
  * 메시의 간선 (Edge between two vertices)
  * - QEM 알고리즘에서 edge collapse의 대상
- * - Cost: Collapse 시 발생하는 quadric error
- * - Optimal position: Collapse 후 새로운 vertex의 최적 위치
+ *
+ * Hot / cold 분리:
+ * - Edge (12 bytes): 양 끝 vertex index + packed flag → topology 순회에서 읽는 부분
+ * - EdgeCost (16 bytes): collapse cost와 optimal position → Mesh::edgeCosts[edge id]에 별도 저장,
+ *   cost 계산 / heap 갱신 / collapse 시에만 읽음
  */
 
-#include <iostream>
-#include <vector>
-#include <GL/glew.h>
-#include <GLFW/glfw3.h>
+#include <cstdint>
 #include <glm/glm.hpp>
-#include <glm/gtc/type_ptr.hpp>
+
+// Edge::flags
+const uint32_t EDGE_DELETED = 1u << 0;  // Edge deletion flag (for simplification)
+const uint32_t EDGE_BOUNDARY = 1u << 1; // 경계 간선 여부 (face 하나에만 속함)
+// (cost 변경 추적은 EdgeHeap의 edge별 generation counter가 담당)
 
 class Edge
 {
 public:
-  int v1;                      // First vertex index
-  int v2;                      // Second vertex index
-  float cost;                  // QEM collapse cost (quadric error)
-  glm::vec3 optimalPosition;   // Optimal position after collapse
-  bool isBoundary;             // 경계 간선 여부 (boundary edge flag)
-  bool isDirty;                // Collapse 후 메시가 변경되었는지 여부 (for lazy updates)
-  bool isDeleted;              // Edge deletion flag (for simplification)
-  
+  int v1;         // First vertex index
+  int v2;         // Second vertex index
+  uint32_t flags; // EDGE_* bit flags
+
   /**
    * Constructor
-   * 
+   *
    * @param vertex1, vertex2 양 끝점의 vertex 인덱스
    */
   Edge(int vertex1, int vertex2)
-      : v1(vertex1), v2(vertex2), isDeleted(false) {
-        isBoundary = false;  // Default: not boundary
-        isDirty = false;     // Default: not dirty
-        cost = 0.f;          // Cost will be computed later
-      }
+      : v1(vertex1), v2(vertex2), flags(0) {}
+
+  bool isDeleted() const { return (flags & EDGE_DELETED) != 0; }
+  bool isBoundary() const { return (flags & EDGE_BOUNDARY) != 0; }
+  void setDeleted() { flags |= EDGE_DELETED; }
+  void setBoundary(bool boundary) { flags = boundary ? (flags | EDGE_BOUNDARY) : (flags & ~EDGE_BOUNDARY); }
+};
+
+/**
+ * Edge collapse cost (cold data, edge id로 index)
+ */
+struct EdgeCost
+{
+  glm::vec3 optimalPosition = glm::vec3(0.f); // Optimal position after collapse
+  float cost = 0.f;                           // QEM collapse cost (quadric error)
 };
 
-#endif // EDGE_H
\ No newline at end of file
+#endif // EDGE_H
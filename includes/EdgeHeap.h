@@ -0,0 +1,284 @@
+#ifndef EDGE_HEAP_H
+#define EDGE_HEAP_H
+
+/**
+ * EdgeHeap.h
+ *
+ * Edge collapse용 lazy min-heap (edge id + generation 기반)
+ * - Entry: (cost, edge id, generation) 12 bytes - Edge 전체를 복사하지 않음
+ * - edge마다 generation counter를 두고, entry는 push 시점의 generation을 기록
+ *   → update() / remove()는 generation만 올리고 이전 entry를 그대로 둠 (stale)
+ * - stale entry는 top으로 올라왔을 때 generation 비교로 O(1)에 버려짐
+ * - update(): push O(log E), remove(): O(1) (+ top이 stale이면 정리)
+ * - stale entry가 EDGE_HEAP_MAX_STALE_FRACTION을 넘으면 live entry만 모아 bulk heapify (메모리 상한)
+ * - 하나의 edge는 live entry를 최대 하나만 가짐
+ * - build(): 초기 entry 전체를 bulk heapify (O(E), E번 push 대신)
+ * - remap(): mesh compaction 후 edge id 갱신 (stale entry도 함께 정리)
+ */
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+// heap 안의 stale entry 비율이 이 값을 넘으면 live entry만으로 다시 heapify
+const float EDGE_HEAP_MAX_STALE_FRACTION = 0.5f;
+
+// 작은 heap은 rebuild하지 않음 (stale entry 수 기준)
+const size_t EDGE_HEAP_MIN_REBUILD = 1024;
+
+class EdgeHeap
+{
+public:
+  struct Entry
+  {
+    float cost;              // Collapse cost (heap key)
+    int edge;                // Edge index (mesh.edges)
+    uint32_t generation = 0; // push 시점의 edge generation (다르면 stale)
+  };
+
+  /**
+   * Reserve generation table for edge ids [0, numEdges)
+   *
+   * @param numEdges 메시의 edge 개수
+   */
+  void reserve(size_t numEdges)
+  {
+    heap.reserve(numEdges);
+    if (generation.size() < numEdges)
+      grow(numEdges);
+  }
+
+  // live entry 수 (stale entry 제외)
+  bool empty() const { return liveCount == 0; }
+  size_t size() const { return liveCount; }
+
+  bool contains(int edge) const
+  {
+    return edge >= 0 && edge < (int)queued.size() && queued[edge] != 0;
+  }
+
+  // 최소 cost entry (heap이 비어있지 않아야 함, top은 항상 live)
+  const Entry &top() const { return heap.front(); }
+
+  /**
+   * Remove minimum entry
+   *
+   * @return 최소 cost edge의 인덱스
+   */
+  int pop()
+  {
+    int edge = heap.front().edge;
+    invalidate(edge);
+    popTop();
+    dropStaleTop();
+    return edge;
+  }
+
+  /**
+   * Insert edge or update its cost
+   *
+   * 새 generation으로 entry를 push하고 이전 entry는 stale로 남김
+   *
+   * @param edge edge 인덱스
+   * @param cost 새로운 collapse cost
+   */
+  void update(int edge, float cost)
+  {
+    if (edge >= (int)generation.size())
+      grow(edge + 1);
+
+    if (queued[edge])
+      generation[edge]++; // 이전 entry는 stale
+    else
+      liveCount++;
+    queued[edge] = 1;
+
+    heap.push_back({cost, edge, generation[edge]});
+    siftUp(heap.size() - 1);
+    dropStaleTop(); // 이전 entry가 top이었을 수 있음
+    rebuildIfStale();
+  }
+
+  /**
+   * Remove edge from heap (heap에 없으면 무시)
+   *
+   * entry는 stale로 남고 top에 올라왔을 때 버려짐
+   *
+   * @param edge edge 인덱스
+   */
+  void remove(int edge)
+  {
+    if (!contains(edge))
+      return;
+    invalidate(edge);
+    dropStaleTop();
+    rebuildIfStale();
+  }
+
+  /**
+   * Build heap from entries at once (bottom-up heapify, O(E))
+   *
+   * 기존 내용은 모두 버려짐. entries의 edge id는 서로 달라야 함
+   *
+   * @param entries (cost, edge id) 목록
+   */
+  void build(std::vector<Entry> entries)
+  {
+    clear();
+    heap = std::move(entries);
+    for (Entry &entry : heap)
+    {
+      if (entry.edge >= (int)generation.size())
+        grow(entry.edge + 1);
+      entry.generation = generation[entry.edge];
+      queued[entry.edge] = 1;
+    }
+    liveCount = heap.size();
+    heapify();
+  }
+
+  /**
+   * Remap edge ids after mesh compaction
+   *
+   * stale entry와 삭제된 edge의 entry를 버리고 새 id로 바꾼 뒤,
+   * 버린 entry가 있었다면 다시 heapify (없으면 cost 순서가 그대로 유지됨)
+   *
+   * @param edgeRemap 이전 edge id → 새 edge id (-1: 삭제됨)
+   * @param numEdges compaction 후 edge 개수
+   */
+  void remap(const std::vector<int> &edgeRemap, size_t numEdges)
+  {
+    std::vector<uint32_t> newGeneration(numEdges, 0);
+    std::vector<uint8_t> newQueued(numEdges, 0);
+
+    size_t kept = 0;
+    for (size_t slot = 0; slot < heap.size(); slot++)
+    {
+      const Entry &entry = heap[slot];
+      int edge = isLive(entry) ? edgeRemap[entry.edge] : -1;
+      if (edge < 0)
+        continue;
+      heap[kept++] = {entry.cost, edge, 0};
+      newQueued[edge] = 1;
+    }
+
+    generation = std::move(newGeneration);
+    queued = std::move(newQueued);
+    liveCount = kept;
+    if (kept != heap.size())
+    {
+      heap.resize(kept);
+      heapify();
+    }
+  }
+
+  void clear()
+  {
+    for (const Entry &entry : heap)
+    {
+      if (isLive(entry))
+        invalidate(entry.edge);
+    }
+    heap.clear();
+    liveCount = 0;
+  }
+
+private:
+  std::vector<Entry> heap;           // Binary min-heap (cost 기준, stale entry 포함)
+  std::vector<uint32_t> generation;  // edge id → 현재 generation
+  std::vector<uint8_t> queued;       // edge id → live entry 존재 여부
+  size_t liveCount = 0;              // live entry 수
+
+  void grow(size_t numEdges)
+  {
+    generation.resize(numEdges, 0);
+    queued.resize(numEdges, 0);
+  }
+
+  bool isLive(const Entry &entry) const
+  {
+    return queued[entry.edge] && entry.generation == generation[entry.edge];
+  }
+
+  // edge의 live entry를 stale로 만듦 (entry는 heap에 남음)
+  void invalidate(int edge)
+  {
+    generation[edge]++;
+    queued[edge] = 0;
+    liveCount--;
+  }
+
+  // top에 올라온 stale entry 제거 → top은 항상 live (또는 heap이 빔)
+  void dropStaleTop()
+  {
+    while (!heap.empty() && !isLive(heap.front()))
+      popTop();
+  }
+
+  // stale entry가 많으면 live entry만 모아 bulk heapify (O(size))
+  void rebuildIfStale()
+  {
+    size_t stale = heap.size() - liveCount;
+    if (stale < EDGE_HEAP_MIN_REBUILD || stale <= EDGE_HEAP_MAX_STALE_FRACTION * heap.size())
+      return;
+
+    size_t kept = 0;
+    for (size_t slot = 0; slot < heap.size(); slot++)
+    {
+      if (isLive(heap[slot]))
+        heap[kept++] = heap[slot];
+    }
+    heap.resize(kept);
+    heapify();
+  }
+
+  void heapify()
+  {
+    for (size_t slot = heap.size() / 2; slot-- > 0;)
+      siftDown(slot);
+  }
+
+  void popTop()
+  {
+    heap.front() = heap.back();
+    heap.pop_back();
+    if (!heap.empty())
+      siftDown(0);
+  }
+
+  void siftUp(size_t slot)
+  {
+    Entry entry = heap[slot];
+    while (slot > 0)
+    {
+      size_t parent = (slot - 1) / 2;
+      if (!(entry.cost < heap[parent].cost))
+        break;
+      heap[slot] = heap[parent];
+      slot = parent;
+    }
+    heap[slot] = entry;
+  }
+
+  void siftDown(size_t slot)
+  {
+    Entry entry = heap[slot];
+    size_t count = heap.size();
+    while (true)
+    {
+      size_t child = slot * 2 + 1;
+      if (child >= count)
+        break;
+      if (child + 1 < count && heap[child + 1].cost < heap[child].cost)
+        child++;
+      if (!(heap[child].cost < entry.cost))
+        break;
+      heap[slot] = heap[child];
+      slot = child;
+    }
+    heap[slot] = entry;
+  }
+};
+
+#endif // EDGE_HEAP_H
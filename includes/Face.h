@@ -3,8 +3,6 @@
 
 #include <iostream>
 #include <vector>
-#include <GL/glew.h>
-#include <GLFW/glfw3.h>
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
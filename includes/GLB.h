@@ -0,0 +1,88 @@
+#ifndef GLB_H
+#define GLB_H
+
+/**
+ * GLB.h
+ *
+ * GLB (binary glTF) 입출력 - OpenGL 의존성 없음
+ * - loadGLBIndexed: unique vertex 배열 + index buffer 로드 (Mesh::buildMeshIndexed 입력)
+ * - loadGLBGeometry: index를 풀어서 corner마다 vertex 로드 (Mesh::buildMesh 입력)
+ * - saveGLB: simplification 결과를 GLB로 저장 (삭제되지 않은 face / vertex만)
+ *
+ * Viewer의 loadGLB (common.h)는 loadGLBIndexed 위에서 GL texture 업로드만 추가
+ */
+
+#include <vector>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include "Mesh.h"
+
+/**
+ * Embedded texture image (CPU 메모리)
+ */
+struct GLBImage
+{
+	int width = 0;
+	int height = 0;
+	int component = 0;                 // 채널 수 (1, 3, 4)
+	std::vector<unsigned char> pixels; // 8-bit per channel, row-major
+};
+
+/**
+ * Load GLB geometry (indexed)
+ *
+ * glTF index buffer와 unique vertex 배열을 그대로 유지 (shared vertex 복사 없음)
+ * 파일은 GLBReader로 mmap하여 읽으므로 BIN chunk의 중간 복사본이 없음
+ * (byteStride, componentType, normalized attribute 지원)
+ * 여러 primitive는 하나의 vertex 배열로 합치고 index에 offset을 더함
+ * (index가 없는 primitive는 0, 1, 2, ... 순서로 생성)
+ *
+ * @param path GLB 파일 경로
+ * @param out_positions vertex 위치
+ * @param out_uvs vertex별 texture 좌표 (없으면 0)
+ * @param out_normals vertex별 normal (없으면 +Z)
+ * @param out_indices triangle index (3개씩 한 face)
+ * @param out_image (optional) 첫 번째 embedded texture (없으면 비어 있음)
+ * @return 성공 여부
+ */
+bool loadGLBIndexed(
+	const char *path,
+	std::vector<glm::vec3> &out_positions,
+	std::vector<glm::vec2> &out_uvs,
+	std::vector<glm::vec3> &out_normals,
+	std::vector<uint32_t> &out_indices,
+	GLBImage *out_image = nullptr);
+
+/**
+ * Load GLB geometry (unrolled triangles)
+ *
+ * 모든 mesh primitive의 index를 풀어서 corner마다 position / uv / normal 출력
+ * (Mesh::buildMesh 입력 형식)
+ *
+ * @param path GLB 파일 경로
+ * @param out_vertices corner별 position
+ * @param out_uvs corner별 texture 좌표 (없으면 0)
+ * @param out_normals corner별 normal (없으면 +Z)
+ * @param out_image (optional) 첫 번째 embedded texture (없으면 비어 있음)
+ * @return 성공 여부
+ */
+bool loadGLBGeometry(
+	const char *path,
+	std::vector<glm::vec3> &out_vertices,
+	std::vector<glm::vec2> &out_uvs,
+	std::vector<glm::vec3> &out_normals,
+	GLBImage *out_image = nullptr);
+
+/**
+ * Save mesh as GLB
+ *
+ * 삭제되지 않은 face와 그 face가 참조하는 vertex만 index buffer로 저장
+ * (POSITION, NORMAL, TEXCOORD_0, uint32 indices)
+ *
+ * @param path 출력 GLB 파일 경로
+ * @param mesh 저장할 메시
+ * @return 성공 여부
+ */
+bool saveGLB(const char *path, const Mesh &mesh);
+
+#endif // GLB_H
@@ -0,0 +1,134 @@
+#ifndef GLBREADER_H
+#define GLBREADER_H
+
+/**
+ * GLBReader.h
+ *
+ * Memory-mapped GLB reader (tinygltf 없이 geometry만 읽음)
+ * - 파일 전체를 mmap (Windows: CreateFileMapping) → BIN chunk를 복사하지 않음
+ * - JSON chunk만 파싱 (nlohmann::json)
+ * - accessor를 typed view로 제공: byteStride / componentType / normalized 처리
+ *
+ * 수 GB 크기의 scan GLB도 파일 크기 정도의 메모리로 읽을 수 있음
+ * (mapping된 page는 file-backed이므로 필요할 때만 올라오고 언제든 회수 가능)
+ *
+ * 지원하지 않는 것: sparse accessor, 외부 .bin buffer (uri)
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <glm/glm.hpp>
+// tinygltf (GLB.cpp)와 같은 설정으로 nlohmann::json 사용
+#ifndef JSON_NOEXCEPTION
+#define JSON_NOEXCEPTION
+#endif
+#include "../lib/json/json.hpp"
+
+// glTF componentType
+const int GLB_COMPONENT_BYTE = 5120;
+const int GLB_COMPONENT_UNSIGNED_BYTE = 5121;
+const int GLB_COMPONENT_SHORT = 5122;
+const int GLB_COMPONENT_UNSIGNED_SHORT = 5123;
+const int GLB_COMPONENT_UNSIGNED_INT = 5125;
+const int GLB_COMPONENT_FLOAT = 5126;
+
+/**
+ * Read-only memory-mapped file
+ */
+class MappedFile
+{
+public:
+	MappedFile() = default;
+	~MappedFile() { close(); }
+	MappedFile(const MappedFile &) = delete;
+	MappedFile &operator=(const MappedFile &) = delete;
+
+	bool open(const char *path);
+	void close();
+
+	const unsigned char *data() const { return mappedData; }
+	size_t size() const { return mappedSize; }
+
+private:
+	const unsigned char *mappedData = nullptr;
+	size_t mappedSize = 0;
+#ifdef _WIN32
+	void *fileHandle = nullptr;    // HANDLE
+	void *mappingHandle = nullptr; // HANDLE
+#endif
+};
+
+/**
+ * Accessor view (복사 없이 mapping된 BIN chunk를 가리킴)
+ *
+ * 원소 i, 성분 c는 data + i * stride + c * componentSize 위치
+ * bufferView가 없는 accessor는 data == nullptr이며 모든 값이 0 (glTF spec)
+ */
+struct GLBAccessorView
+{
+	const unsigned char *data = nullptr;
+	size_t count = 0;      // 원소 수
+	size_t stride = 0;     // 원소 간 byte 간격 (byteStride, 없으면 tightly packed)
+	int componentType = 0; // GLB_COMPONENT_*
+	int components = 0;    // SCALAR 1, VEC2 2, VEC3 3, VEC4 4
+	bool normalized = false;
+
+	// 성분 c를 float로 읽음 (normalized 정수는 [0, 1] / [-1, 1]로 변환)
+	float getFloat(size_t i, int c) const;
+	// 정수 index로 읽음 (index buffer용)
+	uint32_t getIndex(size_t i) const;
+
+	glm::vec2 getVec2(size_t i) const { return glm::vec2(getFloat(i, 0), getFloat(i, 1)); }
+	glm::vec3 getVec3(size_t i) const { return glm::vec3(getFloat(i, 0), getFloat(i, 1), getFloat(i, 2)); }
+};
+
+/**
+ * GLB reader
+ *
+ * open() 이후 json()으로 glTF 구조를 탐색하고 accessor()로 데이터를 읽음
+ * view는 reader가 살아 있는 동안만 유효
+ */
+class GLBReader
+{
+public:
+	/**
+	 * Open GLB file
+	 *
+	 * header / chunk 구조를 검증하고 JSON chunk만 파싱
+	 *
+	 * @param path GLB 파일 경로
+	 * @return 성공 여부 (실패 시 error()에 사유)
+	 */
+	bool open(const char *path);
+
+	const nlohmann::json &json() const { return document; }
+	const std::string &error() const { return errorMessage; }
+
+	/**
+	 * Accessor view
+	 *
+	 * @param index accessor index
+	 * @param out_view [out] view
+	 * @return accessor가 유효하고 BIN chunk 범위 안에 있으면 true
+	 */
+	bool accessor(int index, GLBAccessorView &out_view);
+
+	/**
+	 * BufferView 원시 byte (embedded image 등)
+	 *
+	 * @param index bufferView index
+	 * @param out_size [out] byte 길이
+	 * @return 데이터 위치 (범위를 벗어나면 nullptr)
+	 */
+	const unsigned char *bufferView(int index, size_t &out_size);
+
+private:
+	MappedFile file;
+	nlohmann::json document;
+	const unsigned char *bin = nullptr; // BIN chunk (buffer 0)
+	size_t binSize = 0;
+	std::string errorMessage;
+};
+
+#endif // GLBREADER_H
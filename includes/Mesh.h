@@ -8,27 +8,113 @@
  * - Vertices: 메시의 모든 정점 (position, normal, UV, quadric)
  * - Edges: 메시의 모든 간선 (중복 제거)
  * - Faces: 메시의 모든 삼각형 (plane equation 포함)
+ * - Incidence: vertex → 인접 face / edge 인덱스 (edge collapse 시 one-ring만 순회)
  */
 
 #include <iostream>
 #include <vector>
-#include <GL/glew.h>
-#include <GLFW/glfw3.h>
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include "Vertex.h"
 #include "Edge.h"
 #include "Face.h"
+#include "Parallel.h"
+#include "RadixSort.h"
 #include <unordered_map>
-#include <map>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Dirty vertex / face slots since the last clear (viewer의 incremental GPU upload용)
+ *
+ * - enable()한 경우에만 기록 (CLI / simplify()에는 비용 없음)
+ * - mark*(): slot을 목록에 한 번만 추가 (flag로 중복 제거)
+ * - full: 모든 slot index가 바뀜 (compact) → 목록 대신 전체를 다시 업로드
+ */
+struct MeshChanges
+{
+  bool enabled = false;
+  bool full = false;
+  std::vector<int> vertices;         // 바뀐 vertex slot (기록 순서)
+  std::vector<int> faces;            // 바뀐 face slot (기록 순서)
+  std::vector<uint8_t> vertexFlags;  // vertex slot → 목록에 있는지
+  std::vector<uint8_t> faceFlags;    // face slot → 목록에 있는지
+
+  // 기록 시작 (처음에는 전체가 dirty)
+  void enable(size_t vertexCount, size_t faceCount)
+  {
+    enabled = true;
+    markAll(vertexCount, faceCount);
+  }
+
+  void markVertex(int v)
+  {
+    if (vertexFlags[v])
+      return;
+    vertexFlags[v] = 1;
+    vertices.push_back(v);
+  }
+
+  void markFace(int f)
+  {
+    if (faceFlags[f])
+      return;
+    faceFlags[f] = 1;
+    faces.push_back(f);
+  }
+
+  // Slot 수가 바뀌었음 (compact): 목록 / flag를 새 크기로 초기화하고 full 표시
+  void markAll(size_t vertexCount, size_t faceCount)
+  {
+    if (!enabled)
+      return;
+    vertices.clear();
+    faces.clear();
+    vertexFlags.assign(vertexCount, 0);
+    faceFlags.assign(faceCount, 0);
+    full = true;
+  }
+
+  // 기록된 변경을 소비한 뒤 호출 (목록에 있는 flag만 지우므로 O(변경 수))
+  void clear()
+  {
+    for (int v : vertices)
+      vertexFlags[v] = 0;
+    for (int f : faces)
+      faceFlags[f] = 0;
+    vertices.clear();
+    faces.clear();
+    full = false;
+  }
+};
+
+class ProgressiveMesh; // ProgressiveMesh.h (collapse log)
 
 class Mesh
 {
 public:
-  std::vector<Vertex> vertices;  // 메시의 모든 정점
+  VertexStore vertices;          // 메시의 모든 정점 (SoA)
   std::vector<Edge> edges;       // 메시의 모든 간선 (unique)
+  std::vector<EdgeCost> edgeCosts; // edge id → collapse cost / optimal position (cold data)
   std::vector<Face> faces;       // 메시의 모든 면 (triangles)
   int deletedVertices = 0;         // 삭제된 정점 수 (simplification 진행 상황 추적용)
+  int deletedFaces = 0;            // 삭제된 면 수 (target face count 판정용)
+
+  std::vector<std::vector<int>> vertexFaces; // vertex → 인접 face 인덱스 (incidence)
+  std::vector<std::vector<int>> vertexEdges; // vertex → 인접 edge 인덱스 (incidence)
+
+  // compact() 이후 vertex → build 시점의 vertex index (compact 전에는 비어 있음 = identity)
+  std::vector<int> originalVertex;
+  // compact() 이후 face → build 시점의 face index (compact 전에는 비어 있음 = identity)
+  std::vector<int> originalFace;
+
+  QuadricUpdate quadricUpdate = QUADRIC_ACCUMULATE; // edgeCollapse()의 v1 quadric 갱신 방식
+
+  MeshChanges changes; // Render 갱신용 dirty slot 기록 (changes.enable() 이후에만)
+  ProgressiveMesh *collapseLog = nullptr; // collapse 기록 (nullptr: 기록 안 함, 소유하지 않음)
 
   /**
    * Build mesh from GLB data
@@ -38,6 +124,7 @@ public:
    * 2. Vertex welding (중복 정점 제거)
    * 3. Faces 생성 (triangulated, plane equation 계산)
    * 4. Edges 추출 (Face로부터, 중복 제거)
+   * 5. Vertex incidence index 생성
    * 
    * @param numVertices 입력 vertex 개수 (unrolled triangles)
    * @param vertices 정점 위치 배열
@@ -52,47 +139,8 @@ public:
     // Step 1: Vertex welding with spatial hashing (O(N))
     // -----------------------------------------------------------------------
     printf("Building mesh with %d input vertices...\n", numVertices);
-    printf("Performing vertex welding...\n");
-    
-    const float GRID_SIZE = 0.001f;
-    const float EPSILON = 0.0001f;
-    std::map<std::tuple<int,int,int>, std::vector<int>> spatialHash;
-    std::vector<int> vertexMapping(numVertices); // unrolled index -> unique index
-    
-    for (int i = 0; i < numVertices; ++i)
-    {
-      if (i % 10000 == 0 && i > 0) {
-        printf("  Processing vertex %d/%d...\n", i, numVertices);
-      }
-      
-      const glm::vec3& pos = vertices[i];
-      int gx = (int)std::floor(pos.x / GRID_SIZE);
-      int gy = (int)std::floor(pos.y / GRID_SIZE);
-      int gz = (int)std::floor(pos.z / GRID_SIZE);
-      auto key = std::make_tuple(gx, gy, gz);
-      
-      bool found = false;
-      auto it = spatialHash.find(key);
-      if (it != spatialHash.end()) {
-        for (int existingIdx : it->second) {
-          const glm::vec3& existingPos = this->vertices[existingIdx].position;
-          if (glm::distance(pos, existingPos) < EPSILON) {
-            vertexMapping[i] = existingIdx;
-            found = true;
-            break;
-          }
-        }
-      }
-      
-      if (!found) {
-        int newIdx = this->vertices.size();
-        this->vertices.push_back(Vertex(pos, normals[i], uvs[i], glm::vec4(1.0f)));
-        spatialHash[key].push_back(newIdx);
-        vertexMapping[i] = newIdx;
-      }
-    }
-    
-    printf("Vertex welding complete: %d -> %zu unique vertices\n", numVertices, this->vertices.size());
+    std::vector<int> vertexMapping; // unrolled index -> unique index
+    weldVertices(numVertices, vertices, uvs, normals, vertexMapping);
 
     // -----------------------------------------------------------------------
     // Step 2: Build faces with remapped indices
@@ -109,9 +157,9 @@ public:
         if (v1 == v2 || v2 == v3 || v3 == v1) continue;
         
         Face face(v1, v2, v3,
-                  this->vertices[v1].position,
-                  this->vertices[v2].position,
-                  this->vertices[v3].position);
+                  this->vertices.positions[v1],
+                  this->vertices.positions[v2],
+                  this->vertices.positions[v3]);
         faces.push_back(face);
       }
     }
@@ -119,33 +167,556 @@ public:
     // -----------------------------------------------------------------------
     // Step 3: Extract unique edges from faces
     // -----------------------------------------------------------------------
-    // Use map to filter duplicate edges
-    // Edge (v1, v2) === Edge (v2, v1), so normalize with min/max
-    std::map<std::pair<int, int>, bool> edgeSet;
-    
-    for (const auto &face : faces)
+    buildEdges();
+
+    // -----------------------------------------------------------------------
+    // Step 4: Build vertex incidence index
+    // -----------------------------------------------------------------------
+    buildIncidence();
+  }
+
+  /**
+   * Build mesh from indexed vertex arrays (glTF index buffer 그대로 사용)
+   *
+   * unique vertex 배열과 index buffer에서 바로 face를 생성하므로
+   * corner마다 vertex를 복사하는 unrolled 경로보다 메모리와 시간이 훨씬 적음
+   * - weld = false: vertex i는 입력 vertex i와 같은 index를 유지
+   * - weld = true: 같은 위치의 vertex를 spatial hash로 병합 (UV / normal seam을 닫을 때)
+   *   → welding은 unique vertex에 대해서만 수행되므로 unrolled 경로보다 작음
+   *
+   * @param positions unique vertex 위치 배열
+   * @param uvs 텍스처 좌표 배열 (비어 있으면 0)
+   * @param normals 법선 벡터 배열 (비어 있으면 +Z)
+   * @param indices triangle index 배열 (3개씩 한 face)
+   * @param weld 위치가 같은 vertex 병합 여부
+   * @param numThreads welding / edge 추출의 thread 수 (0: hardware concurrency)
+   */
+  void buildMeshIndexed(const std::vector<glm::vec3> &positions, const std::vector<glm::vec2> &uvs,
+                        const std::vector<glm::vec3> &normals, const std::vector<uint32_t> &indices,
+                        bool weld = false, int numThreads = 0)
+  {
+    int numVertices = (int)positions.size();
+    printf("Building mesh with %d vertices, %zu indices...\n", numVertices, indices.size());
+
+    // -----------------------------------------------------------------------
+    // Step 1: Vertices (optional welding)
+    // -----------------------------------------------------------------------
+    std::vector<int> vertexMapping; // input index -> mesh index (weld일 때만 사용)
+    if (weld)
+    {
+      weldVertices(numVertices, positions, uvs, normals, vertexMapping, numThreads);
+    }
+    else
     {
-      // Each face has 3 edges: (v1,v2), (v2,v3), (v3,v1)
-      auto e1 = std::make_pair(std::min(face.v1, face.v2), std::max(face.v1, face.v2));
-      auto e2 = std::make_pair(std::min(face.v2, face.v3), std::max(face.v2, face.v3));
-      auto e3 = std::make_pair(std::min(face.v3, face.v1), std::max(face.v3, face.v1));
+      vertices.reserve(numVertices);
+      for (int i = 0; i < numVertices; ++i)
+        vertices.add(positions[i],
+                     normals.empty() ? glm::vec3(0.f, 0.f, 1.f) : normals[i],
+                     uvs.empty() ? glm::vec2(0.f) : uvs[i],
+                     glm::vec4(1.0f));
+    }
+
+    // -----------------------------------------------------------------------
+    // Step 2: Faces from index buffer
+    // -----------------------------------------------------------------------
+    faces.reserve(indices.size() / 3);
+    for (size_t i = 0; i + 2 < indices.size(); i += 3)
+    {
+      if (indices[i] >= (uint32_t)numVertices || indices[i + 1] >= (uint32_t)numVertices ||
+          indices[i + 2] >= (uint32_t)numVertices)
+        continue;
+
+      int v1 = weld ? vertexMapping[indices[i]] : (int)indices[i];
+      int v2 = weld ? vertexMapping[indices[i + 1]] : (int)indices[i + 1];
+      int v3 = weld ? vertexMapping[indices[i + 2]] : (int)indices[i + 2];
+
+      // Skip degenerate faces
+      if (v1 == v2 || v2 == v3 || v3 == v1) continue;
+
+      faces.push_back(Face(v1, v2, v3,
+                           vertices.positions[v1],
+                           vertices.positions[v2],
+                           vertices.positions[v3]));
+    }
+
+    // -----------------------------------------------------------------------
+    // Step 3: Edges, Step 4: Incidence
+    // -----------------------------------------------------------------------
+    buildEdges(numThreads);
+    buildIncidence();
+  }
+
+  /**
+   * Vertex welding (sort-based, parallel)
+   *
+   * 위치가 EPSILON 이내인 입력 vertex를 하나로 병합하여 vertices에 추가
+   * 1. 위치를 GRID_SIZE cell로 양자화 → cell 좌표의 Morton key
+   * 2. (key, index)를 병렬 radix sort → 같은 cell의 vertex가 연속 구간에 모임
+   * 3. vertex마다 자기 cell + (cell 경계에서 EPSILON 이내인 방향의) 이웃 cell을 검사하여
+   *    EPSILON 이내의 가장 작은 index를 대표로 선택 (병렬)
+   * 4. index 순서로 대표를 따라가며 unique vertex 생성 (처음 나온 vertex의 normal / UV 사용)
+   *
+   * @param numVertices 입력 vertex 개수
+   * @param positions 입력 위치 배열
+   * @param uvs 텍스처 좌표 배열 (비어 있으면 0)
+   * @param normals 법선 벡터 배열 (비어 있으면 +Z)
+   * @param vertexMapping [out] 입력 index -> mesh vertex index
+   * @param numThreads thread 수 (0: hardware concurrency)
+   */
+  void weldVertices(int numVertices, const std::vector<glm::vec3> &positions,
+                    const std::vector<glm::vec2> &uvs, const std::vector<glm::vec3> &normals,
+                    std::vector<int> &vertexMapping, int numThreads = 0)
+  {
+    printf("Performing vertex welding...\n");
+
+    const float GRID_SIZE = 0.001f;
+    const float EPSILON = 0.0001f;
+    const int CELL_BITS = 21;                     // Morton key: 3 x 21 bits
+    const int MAX_CELL = (1 << CELL_BITS) - 1;
+    vertexMapping.assign(numVertices, -1);
+    if (numVertices == 0)
+      return;
+
+    // -----------------------------------------------------------------------
+    // 1. Quantize to cells (bounding box 기준, 범위가 크면 cell을 키움)
+    // -----------------------------------------------------------------------
+    glm::vec3 minPos = positions[0];
+    glm::vec3 maxPos = positions[0];
+    for (int i = 1; i < numVertices; ++i)
+    {
+      minPos = glm::min(minPos, positions[i]);
+      maxPos = glm::max(maxPos, positions[i]);
+    }
+    glm::vec3 extent = maxPos - minPos;
+    float cellSize = std::max(GRID_SIZE, std::max(extent.x, std::max(extent.y, extent.z)) / (float)MAX_CELL);
+
+    auto cellOf = [&](const glm::vec3 &pos)
+    {
+      glm::ivec3 cell = glm::ivec3(glm::floor((pos - minPos) / cellSize));
+      return glm::clamp(cell, glm::ivec3(0), glm::ivec3(MAX_CELL));
+    };
+
+    std::vector<uint64_t> keys(numVertices);
+    std::vector<int> order(numVertices);
+    parallelFor(0, numVertices, [&](int i)
+    {
+      keys[i] = mortonKey(cellOf(positions[i]));
+      order[i] = i;
+    }, numThreads);
+
+    // -----------------------------------------------------------------------
+    // 2. Sort by cell (stable: 같은 cell 안에서는 index 오름차순)
+    // -----------------------------------------------------------------------
+    radixSortPairs(keys, order, numThreads);
+
+    // -----------------------------------------------------------------------
+    // 3. Cell 구간 (run boundary): 정렬된 key를 한 번 순회하여 cell마다 시작 위치 계산
+    // -----------------------------------------------------------------------
+    std::vector<int> runStart;            // run r의 정렬 위치 [runStart[r], runStart[r + 1])
+    std::vector<int> runOf(numVertices);  // 정렬 위치 → run
+    for (int s = 0; s < numVertices; ++s)
+    {
+      if (s == 0 || keys[s] != keys[s - 1])
+        runStart.push_back(s);
+      runOf[s] = (int)runStart.size() - 1;
+    }
+    const int numRuns = (int)runStart.size();
+    runStart.push_back(numVertices);
 
-      // Add edge only if not already in set
-      if (!edgeSet[e1])
+    // 이웃 cell 조회용 open-addressing table (cell key → run, linear probing)
+    // 경계 근처 vertex만 조회하고, 조회는 O(1) (정렬 배열 전체의 이진 탐색 없음)
+    int tableBits = 1;
+    while ((1 << tableBits) < numRuns * 2)
+      ++tableBits;
+    const size_t tableMask = ((size_t)1 << tableBits) - 1;
+    auto slotOf = [&](uint64_t key)
+    {
+      return (size_t)((key * 0x9E3779B97F4A7C15ULL) >> (64 - tableBits));
+    };
+    std::vector<int> table(tableMask + 1, -1);
+    for (int r = 0; r < numRuns; ++r)
+    {
+      size_t h = slotOf(keys[runStart[r]]);
+      while (table[h] >= 0)
+        h = (h + 1) & tableMask;
+      table[h] = r;
+    }
+    auto findRun = [&](uint64_t key)
+    {
+      for (size_t h = slotOf(key);; h = (h + 1) & tableMask)
       {
-        edges.push_back(Edge(e1.first, e1.second));
-        edgeSet[e1] = true;
+        int r = table[h];
+        if (r < 0 || keys[runStart[r]] == key)
+          return r;
       }
-      if (!edgeSet[e2])
+    };
+
+    // -----------------------------------------------------------------------
+    // 4. 대표 vertex 찾기: EPSILON 이내인 가장 작은 index (자기 자신 포함)
+    // -----------------------------------------------------------------------
+    std::vector<int> representative(numVertices);
+    parallelFor(0, numVertices, [&](int s)
+    {
+      int i = order[s];
+      const glm::vec3 &pos = positions[i];
+      glm::ivec3 cell = cellOf(pos);
+      glm::vec3 local = (pos - minPos) - glm::vec3(cell) * cellSize; // cell 안의 위치
+
+      // 축마다 검사할 cell 범위: 경계에서 EPSILON 이내일 때만 이웃 포함
+      glm::ivec3 lo, hi;
+      for (int axis = 0; axis < 3; ++axis)
       {
-        edges.push_back(Edge(e2.first, e2.second));
-        edgeSet[e2] = true;
+        lo[axis] = (local[axis] < EPSILON && cell[axis] > 0) ? -1 : 0;
+        hi[axis] = (local[axis] > cellSize - EPSILON && cell[axis] < MAX_CELL) ? 1 : 0;
       }
-      if (!edgeSet[e3])
+
+      int best = i;
+      for (int dz = lo.z; dz <= hi.z; ++dz)
+        for (int dy = lo.y; dy <= hi.y; ++dy)
+          for (int dx = lo.x; dx <= hi.x; ++dx)
+          {
+            // 자기 cell은 정렬 위치에서 바로, 이웃 cell은 table에서
+            bool self = (dx == 0 && dy == 0 && dz == 0);
+            int r = self ? runOf[s] : findRun(mortonKey(cell + glm::ivec3(dx, dy, dz)));
+            if (r < 0)
+              continue;
+            for (int t = runStart[r]; t < runStart[r + 1]; ++t)
+            {
+              int j = order[t];
+              if (j < best && glm::distance(pos, positions[j]) < EPSILON)
+                best = j;
+            }
+          }
+      representative[i] = best;
+    }, numThreads, 1024);
+
+    // -----------------------------------------------------------------------
+    // 5. Unique vertices in input order (대표는 항상 더 작은 index이므로 한 번의 순회로 충분)
+    // -----------------------------------------------------------------------
+    for (int i = 0; i < numVertices; ++i)
+    {
+      if (representative[i] != i)
       {
-        edges.push_back(Edge(e3.first, e3.second));
-        edgeSet[e3] = true;
+        vertexMapping[i] = vertexMapping[representative[i]];
+        continue;
       }
+
+      vertexMapping[i] = vertices.add(positions[i],
+                                      normals.empty() ? glm::vec3(0.f, 0.f, 1.f) : normals[i],
+                                      uvs.empty() ? glm::vec2(0.f) : uvs[i],
+                                      glm::vec4(1.0f));
+    }
+
+    printf("Vertex welding complete: %d -> %zu unique vertices\n", numVertices, vertices.size());
+  }
+
+  // 21-bit cell 좌표 3개를 interleave한 Morton key (공간적으로 가까운 cell이 가까운 key)
+  static uint64_t mortonKey(const glm::ivec3 &cell)
+  {
+    auto spread = [](uint64_t v)
+    {
+      v &= 0x1fffff;
+      v = (v | v << 32) & 0x1f00000000ffffULL;
+      v = (v | v << 16) & 0x1f0000ff0000ffULL;
+      v = (v | v << 8) & 0x100f00f00f00f00fULL;
+      v = (v | v << 4) & 0x10c30c30c30c30c3ULL;
+      v = (v | v << 2) & 0x1249249249249249ULL;
+      return v;
+    };
+    return spread((uint64_t)cell.x) | (spread((uint64_t)cell.y) << 1) | (spread((uint64_t)cell.z) << 2);
+  }
+
+  /**
+   * Build mesh from caller-owned indexed buffers (no welding)
+   *
+   * position / index buffer를 그대로 읽어 Mesh 생성:
+   * - vertex i는 입력 vertex i와 같은 index를 유지 (welding 없음)
+   * - degenerate face (같은 index 반복)는 건너뜀
+   * - normal은 +Z, UV는 0, color는 흰색으로 초기화
+   * (빈 Mesh에 호출해야 함)
+   *
+   * @param positions 첫 vertex의 x 좌표 (float xyz)
+   * @param positionStride vertex 간 byte 간격 (0: 3 * sizeof(float))
+   * @param numVertices vertex 개수
+   * @param indices triangle index 배열 (3개씩 한 face)
+   * @param numIndices index 개수
+   */
+  void buildMeshIndexed(const float *positions, size_t positionStride, int numVertices,
+                        const uint32_t *indices, int numIndices)
+  {
+    if (positionStride == 0)
+      positionStride = 3 * sizeof(float);
+
+    // -----------------------------------------------------------------------
+    // Step 1: Vertices (index 보존)
+    // -----------------------------------------------------------------------
+    const unsigned char *base = reinterpret_cast<const unsigned char *>(positions);
+    vertices.reserve(numVertices);
+    for (int i = 0; i < numVertices; ++i)
+    {
+      const float *p = reinterpret_cast<const float *>(base + (size_t)i * positionStride);
+      vertices.add(glm::vec3(p[0], p[1], p[2]), glm::vec3(0.f, 0.f, 1.f),
+                   glm::vec2(0.f), glm::vec4(1.0f));
+    }
+
+    // -----------------------------------------------------------------------
+    // Step 2: Faces from index buffer
+    // -----------------------------------------------------------------------
+    faces.reserve(numIndices / 3);
+    for (int i = 0; i + 2 < numIndices; i += 3)
+    {
+      // Skip out-of-range faces (int 변환 전에 비교: 0x80000000 이상은 음수가 됨)
+      if (indices[i] >= (uint32_t)numVertices || indices[i + 1] >= (uint32_t)numVertices ||
+          indices[i + 2] >= (uint32_t)numVertices)
+        continue;
+
+      int v1 = (int)indices[i];
+      int v2 = (int)indices[i + 1];
+      int v3 = (int)indices[i + 2];
+
+      // Skip degenerate faces
+      if (v1 == v2 || v2 == v3 || v3 == v1) continue;
+
+      faces.push_back(Face(v1, v2, v3,
+                           vertices.positions[v1],
+                           vertices.positions[v2],
+                           vertices.positions[v3]));
+    }
+
+    // -----------------------------------------------------------------------
+    // Step 3: Edges, Step 4: Incidence
+    // -----------------------------------------------------------------------
+    buildEdges();
+    buildIncidence();
+  }
+
+  /**
+   * Extract unique edges from faces (sort-based)
+   *
+   * 1. face의 세 변을 (min << 32 | max) 64-bit key로 출력 (병렬)
+   * 2. key를 병렬 radix sort → 같은 edge가 연속 구간에 모임
+   * 3. 구간마다 Edge 하나 생성, 구간 길이 = edge를 공유하는 face 수
+   *    → face가 하나뿐인 edge는 EDGE_BOUNDARY
+   *
+   * edges는 (v1, v2) 오름차순으로 생성됨
+   *
+   * @param numThreads thread 수 (0: hardware concurrency)
+   */
+  void buildEdges(int numThreads = 0)
+  {
+    const int numFaces = (int)faces.size();
+    std::vector<uint64_t> keys((size_t)numFaces * 3);
+
+    // Edge (v1, v2) === Edge (v2, v1), so normalize with min/max
+    auto edgeKey = [](int a, int b)
+    {
+      return ((uint64_t)(uint32_t)std::min(a, b) << 32) | (uint32_t)std::max(a, b);
+    };
+
+    parallelFor(0, numFaces, [&](int i)
+    {
+      const Face &face = faces[i];
+      keys[(size_t)i * 3 + 0] = edgeKey(face.v1, face.v2);
+      keys[(size_t)i * 3 + 1] = edgeKey(face.v2, face.v3);
+      keys[(size_t)i * 3 + 2] = edgeKey(face.v3, face.v1);
+    }, numThreads);
+
+    radixSortKeys(keys, numThreads);
+
+    // Deduplicate sorted keys (run length = face count)
+    for (size_t i = 0; i < keys.size();)
+    {
+      size_t runEnd = i + 1;
+      while (runEnd < keys.size() && keys[runEnd] == keys[i])
+        runEnd++;
+
+      Edge edge((int)(keys[i] >> 32), (int)(keys[i] & 0xffffffffu));
+      edge.setBoundary(runEnd - i == 1);
+      edges.push_back(edge);
+      i = runEnd;
+    }
+    edgeCosts.resize(edges.size());
+  }
+
+  // 삭제되지 않은 face 수
+  int liveFaceCount() const { return (int)faces.size() - deletedFaces; }
+
+  // 삭제된 face 비율 (compaction 판단용)
+  float deadFraction() const { return faces.empty() ? 0.f : (float)deletedFaces / (float)faces.size(); }
+
+  /**
+   * Record the slots an edge collapse is about to change (changes.enabled일 때만)
+   *
+   * - v1: 위치 / color / UV가 바뀜 (v2는 삭제되어 더 이상 참조되지 않음)
+   * - v2의 face: v2 → v1 remap 또는 degenerate로 삭제
+   * collapse 전에 호출해야 함 (병렬 collapse는 batch 전에 순차적으로 호출)
+   */
+  void recordCollapse(const Edge &edge)
+  {
+    if (!changes.enabled)
+      return;
+    changes.markVertex(edge.v1);
+    for (int f : vertexFaces[edge.v2])
+      changes.markFace(f);
+  }
+
+  // build 시점의 vertex index (compact() 이후에도 유지)
+  int originalVertexIndex(int vertexIndex) const
+  {
+    return originalVertex.empty() ? vertexIndex : originalVertex[vertexIndex];
+  }
+
+  // build 시점의 face index (compact() 이후에도 유지)
+  int originalFaceIndex(int faceIndex) const
+  {
+    return originalFace.empty() ? faceIndex : originalFace[faceIndex];
+  }
+
+  /**
+   * Compact mesh (삭제된 vertex / edge / face 제거)
+   *
+   * simplification이 진행될수록 배열 대부분이 삭제된 entry가 되어 모든 순회가 느려지므로
+   * live entry만 앞으로 모으고 index를 remap:
+   * 1. vertex (SoA 배열 전체), face, edge + edgeCosts를 순서를 유지하며 압축
+   * 2. face / edge의 vertex index, incidence 목록의 face / edge index를 새 index로 변경
+   * 3. originalVertex / originalFace 갱신, deletedVertices / deletedFaces = 0
+   *    (changes 기록 중이면 모든 slot index가 바뀌므로 full로 표시)
+   *
+   * edge id가 바뀌므로 EdgeHeap 등 edge id를 가진 구조는 edgeRemap으로 갱신해야 함
+   *
+   * @param edgeRemap (optional) [out] 이전 edge id → 새 edge id (-1: 삭제됨)
+   * @param numThreads thread 수 (0: hardware concurrency)
+   */
+  void compact(std::vector<int> *edgeRemap = nullptr, int numThreads = 0)
+  {
+    // -----------------------------------------------------------------------
+    // Step 1: Vertices
+    // -----------------------------------------------------------------------
+    const int oldVertexCount = (int)vertices.size();
+    std::vector<int> vertexRemap(oldVertexCount, -1);
+    VertexStore liveVertices;
+    liveVertices.hasQuadrics = vertices.hasQuadrics;
+    liveVertices.reserve(oldVertexCount - deletedVertices);
+    std::vector<int> liveOriginal;
+    liveOriginal.reserve(oldVertexCount - deletedVertices);
+    for (int i = 0; i < oldVertexCount; ++i)
+    {
+      if (vertices.isDeleted(i))
+        continue;
+      vertexRemap[i] = liveVertices.add(vertices.positions[i], vertices.normals[i],
+                                        vertices.texCoords[i], vertices.colors[i]);
+      if (vertices.hasQuadrics)
+        liveVertices.quadrics.back() = vertices.quadrics[i];
+      liveOriginal.push_back(originalVertexIndex(i));
+    }
+    vertices = std::move(liveVertices);
+    originalVertex = std::move(liveOriginal);
+
+    // -----------------------------------------------------------------------
+    // Step 2: Faces
+    // -----------------------------------------------------------------------
+    std::vector<int> faceRemap(faces.size(), -1);
+    std::vector<int> liveOriginalFace;
+    liveOriginalFace.reserve(faces.size() - deletedFaces);
+    int liveFaces = 0;
+    for (int i = 0; i < (int)faces.size(); ++i)
+    {
+      if (faces[i].isDeleted)
+        continue;
+      liveOriginalFace.push_back(originalFaceIndex(i));
+      Face face = faces[i];
+      face.v1 = vertexRemap[face.v1];
+      face.v2 = vertexRemap[face.v2];
+      face.v3 = vertexRemap[face.v3];
+      faceRemap[i] = liveFaces;
+      faces[liveFaces++] = face;
+    }
+    faces.erase(faces.begin() + liveFaces, faces.end());
+    faces.shrink_to_fit();
+    originalFace = std::move(liveOriginalFace);
+
+    // -----------------------------------------------------------------------
+    // Step 3: Edges + cold cost data
+    // -----------------------------------------------------------------------
+    std::vector<int> localEdgeRemap;
+    std::vector<int> &edgeMap = edgeRemap ? *edgeRemap : localEdgeRemap;
+    edgeMap.assign(edges.size(), -1);
+    int liveEdges = 0;
+    for (int i = 0; i < (int)edges.size(); ++i)
+    {
+      if (edges[i].isDeleted())
+        continue;
+      Edge edge = edges[i];
+      edge.v1 = vertexRemap[edge.v1];
+      edge.v2 = vertexRemap[edge.v2];
+      edgeMap[i] = liveEdges;
+      edgeCosts[liveEdges] = edgeCosts[i];
+      edges[liveEdges++] = edge;
+    }
+    edges.erase(edges.begin() + liveEdges, edges.end());
+    edges.shrink_to_fit();
+    edgeCosts.resize(liveEdges);
+    edgeCosts.shrink_to_fit();
+
+    // -----------------------------------------------------------------------
+    // Step 4: Incidence (살아있는 vertex의 목록만 옮기고 id 갱신)
+    // -----------------------------------------------------------------------
+    std::vector<std::vector<int>> liveVertexFaces(vertices.size());
+    std::vector<std::vector<int>> liveVertexEdges(vertices.size());
+    parallelFor(0, oldVertexCount, [&](int i)
+    {
+      int v = vertexRemap[i];
+      if (v < 0)
+        return;
+      liveVertexFaces[v] = std::move(vertexFaces[i]);
+      liveVertexEdges[v] = std::move(vertexEdges[i]);
+      for (int &f : liveVertexFaces[v])
+        f = faceRemap[f];
+      for (int &e : liveVertexEdges[v])
+        e = edgeMap[e];
+      // 목록에 남아 있던 삭제된 face / edge 제거
+      auto &fs = liveVertexFaces[v];
+      fs.erase(std::remove(fs.begin(), fs.end(), -1), fs.end());
+      auto &es = liveVertexEdges[v];
+      es.erase(std::remove(es.begin(), es.end(), -1), es.end());
+    }, numThreads);
+    vertexFaces = std::move(liveVertexFaces);
+    vertexEdges = std::move(liveVertexEdges);
+
+    deletedVertices = 0;
+    deletedFaces = 0;
+    changes.markAll(vertices.size(), faces.size());
+  }
+
+  /**
+   * Build vertex incidence index
+   *
+   * 각 vertex에 인접한 face / edge 인덱스 목록 생성 (O(V + E + F))
+   * - edgeCollapse()는 이 목록을 통해 v1, v2의 one-ring만 갱신
+   * - 삭제된 face / edge는 포함하지 않음
+   */
+  void buildIncidence()
+  {
+    vertexFaces.assign(vertices.size(), std::vector<int>());
+    vertexEdges.assign(vertices.size(), std::vector<int>());
+
+    for (int i = 0; i < (int)faces.size(); ++i)
+    {
+      const Face &face = faces[i];
+      if (face.isDeleted)
+        continue;
+      vertexFaces[face.v1].push_back(i);
+      vertexFaces[face.v2].push_back(i);
+      vertexFaces[face.v3].push_back(i);
+    }
+
+    for (int i = 0; i < (int)edges.size(); ++i)
+    {
+      const Edge &edge = edges[i];
+      if (edge.isDeleted())
+        continue;
+      vertexEdges[edge.v1].push_back(i);
+      vertexEdges[edge.v2].push_back(i);
     }
   }
 };
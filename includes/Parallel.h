@@ -0,0 +1,218 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+/**
+ * Parallel.h
+ *
+ * 간단한 병렬 loop 유틸리티 (std::thread 기반)
+ * - parallelFor: [begin, end) 구간을 thread 수만큼 연속된 chunk로 나눠 실행
+ * - chunk는 프로세스 전체에서 한 번 만든 ThreadPool의 worker가 실행
+ *   (병렬 엔진처럼 round마다 parallelFor를 호출해도 thread 생성 / join 비용이 없음)
+ * - 각 index는 정확히 한 번, 하나의 thread에서만 실행됨
+ *   → index별로 서로 다른 원소에 쓰는 loop (gather)는 동기화 불필요
+ */
+
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+// 이보다 작은 chunk는 worker를 깨우는 비용이 더 큼
+const int PARALLEL_MIN_CHUNK = 4096;
+
+/**
+ * Resolve thread count
+ *
+ * @param numThreads 요청 thread 수 (0 이하: hardware concurrency)
+ * @return 실제 사용할 thread 수 (>= 1)
+ */
+inline int resolveThreadCount(int numThreads)
+{
+  if (numThreads > 0)
+    return numThreads;
+  unsigned int hardwareThreads = std::thread::hardware_concurrency();
+  return hardwareThreads > 0 ? (int)hardwareThreads : 1;
+}
+
+/**
+ * Persistent worker pool (parallelFor 전용)
+ *
+ * - 처음 사용할 때 만들고 필요한 thread 수만큼만 늘림, 프로세스 종료 시 join
+ * - job 하나 = task [0, tasks): task는 worker와 호출 thread가 atomic counter로 나눠 가짐
+ * - 한 번에 job 하나만 실행: 다른 thread가 사용 중이거나 pool 안에서 다시 호출되면
+ *   run()이 false를 반환하고 호출자가 직접 실행 (nested parallelFor에서 deadlock 없음)
+ */
+class ThreadPool
+{
+public:
+  static ThreadPool &instance()
+  {
+    static ThreadPool pool;
+    return pool;
+  }
+
+  ~ThreadPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread &worker : workers)
+      worker.join();
+  }
+
+  /**
+   * Run task(t) for every t in [0, tasks) and wait for all of them
+   *
+   * @param tasks task 수 (worker는 tasks - 1개까지 참여, 나머지는 호출 thread)
+   * @param task void(int) 함수
+   * @return pool을 사용했으면 true (false: 아무것도 실행하지 않음)
+   */
+  template <typename Task>
+  bool run(int tasks, const Task &task)
+  {
+    if (insideWorker())
+      return false;
+    std::unique_lock<std::mutex> submit(submitMutex, std::try_to_lock);
+    if (!submit.owns_lock())
+      return false;
+
+    ensureWorkers(tasks - 1);
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      jobContext = &task;
+      jobInvoke = [](const void *context, int t)
+      { (*static_cast<const Task *>(context))(t); };
+      jobTasks = tasks;
+      nextTask.store(0);
+      finishedTasks = 0;
+      ++generation;
+    }
+    wake.notify_all();
+
+    int finished = drainTasks();
+
+    // 모든 task가 끝나고 job을 잡은 worker가 모두 빠져나간 뒤 job 해제
+    std::unique_lock<std::mutex> lock(mutex);
+    finishedTasks += finished;
+    done.wait(lock, [this]
+              { return finishedTasks == jobTasks && activeWorkers == 0; });
+    jobContext = nullptr;
+    return true;
+  }
+
+private:
+  ThreadPool() = default;
+
+  static bool &insideWorker()
+  {
+    static thread_local bool inside = false;
+    return inside;
+  }
+
+  // submitMutex를 가진 상태에서만 호출 (job이 없을 때)
+  void ensureWorkers(int count)
+  {
+    while ((int)workers.size() < count)
+      workers.emplace_back(&ThreadPool::workerLoop, this);
+  }
+
+  // 남은 task를 가져와 실행, 실행한 task 수 반환
+  int drainTasks()
+  {
+    int finished = 0;
+    for (int t = nextTask.fetch_add(1); t < jobTasks; t = nextTask.fetch_add(1))
+    {
+      jobInvoke(jobContext, t);
+      finished++;
+    }
+    return finished;
+  }
+
+  void workerLoop()
+  {
+    insideWorker() = true;
+    unsigned long long seen = 0;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+      wake.wait(lock, [&]
+                { return stopping || generation != seen; });
+      if (stopping)
+        return;
+      seen = generation;
+      if (jobContext == nullptr)
+        continue; // 이미 끝난 job
+
+      ++activeWorkers;
+      lock.unlock();
+      int finished = drainTasks();
+      lock.lock();
+      --activeWorkers;
+      finishedTasks += finished;
+      if (finishedTasks == jobTasks && activeWorkers == 0)
+        done.notify_one();
+    }
+  }
+
+  std::vector<std::thread> workers;
+  std::mutex submitMutex; // job 하나씩
+  std::mutex mutex;       // 아래 job 상태 보호 (nextTask 제외)
+  std::condition_variable wake;
+  std::condition_variable done;
+  bool stopping = false;
+  unsigned long long generation = 0;
+  const void *jobContext = nullptr;
+  void (*jobInvoke)(const void *, int) = nullptr;
+  int jobTasks = 0;
+  int finishedTasks = 0;
+  int activeWorkers = 0;
+  std::atomic<int> nextTask{0};
+};
+
+/**
+ * Parallel for loop
+ *
+ * @param begin, end 반복 구간 [begin, end)
+ * @param func 각 index에 대해 호출할 함수 (void(int))
+ * @param numThreads thread 수 (0: hardware concurrency)
+ * @param minChunk thread 하나가 맡을 최소 index 수 (index당 작업이 무거우면 작게)
+ */
+template <typename Func>
+void parallelFor(int begin, int end, const Func &func, int numThreads = 0,
+                 int minChunk = PARALLEL_MIN_CHUNK)
+{
+  int count = end - begin;
+  if (count <= 0)
+    return;
+
+  int maxThreads = (count + minChunk - 1) / minChunk;
+  int threads = std::min(resolveThreadCount(numThreads), maxThreads);
+  if (threads <= 1)
+  {
+    for (int i = begin; i < end; i++)
+      func(i);
+    return;
+  }
+
+  int chunk = (count + threads - 1) / threads;
+  auto runChunk = [&func, begin, end, chunk](int t)
+  {
+    int chunkBegin = begin + t * chunk;
+    int chunkEnd = std::min(end, chunkBegin + chunk);
+    for (int i = chunkBegin; i < chunkEnd; i++)
+      func(i);
+  };
+
+  // Pool이 다른 thread에서 사용 중이거나 nested 호출이면 호출 thread에서 순서대로 실행
+  if (!ThreadPool::instance().run(threads, runChunk))
+  {
+    for (int t = 0; t < threads; t++)
+      runChunk(t);
+  }
+}
+
+#endif // PARALLEL_H
@@ -0,0 +1,147 @@
+#ifndef PROGRESSIVE_MESH_H
+#define PROGRESSIVE_MESH_H
+
+/**
+ * ProgressiveMesh.h
+ *
+ * Progressive mesh collapse log (vertex split 기록)
+ * - simplification 중 collapse마다 v1, v2, collapse 전후 v1 attribute,
+ *   v2를 참조하던 face corner를 기록
+ * - 모든 id는 build 시점 (base) 기준이므로 compact() 후에도 유효 (originalVertex / originalFace)
+ * - ProgressiveMeshCursor로 collapse (앞으로) / vertex split (뒤로)을 재생해
+ *   원본과 최종 결과 사이의 임의 LOD를 simplification 재실행 없이 복원
+ *
+ * 참고 논문:
+ * Hoppe, H. (1996). "Progressive meshes." SIGGRAPH 96.
+ */
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <glm/glm.hpp>
+#include "Mesh.h"
+
+/**
+ * LOD 사이에서 바뀌는 vertex attribute (normal은 collapse가 바꾸지 않으므로 base에만)
+ */
+struct PMVertex
+{
+  glm::vec3 position;
+  glm::vec2 texCoord;
+  glm::vec4 color;
+};
+
+/**
+ * Collapse 하나 (= 반대 방향으로 vertex split 하나)
+ *
+ * - collapse: corners의 vertex를 v2 → v1, v1 attribute = v1After
+ * - split: corners의 vertex를 v1 → v2, v1 attribute = v1Before
+ *   (v2 attribute는 collapse 후 아무도 바꾸지 않으므로 기록할 필요 없음)
+ */
+struct PMCollapse
+{
+  int v1;              // 남는 vertex (base id)
+  int v2;              // 병합되어 사라지는 vertex (base id)
+  PMVertex v1Before;   // collapse 전 v1
+  PMVertex v1After;    // collapse 후 v1 (optimal position, 보간된 attribute)
+  int firstCorner;     // ProgressiveMesh::corners 범위 시작
+  int cornerCount;     // collapse 전 v2를 참조하던 corner 수 (face id * 3 + k)
+  int liveFaces;       // 이 collapse까지 적용한 LOD의 face 수
+};
+
+/**
+ * Collapse log 전체 (base mesh + collapse 순서)
+ *
+ * 기록: begin() 후 mesh.collapseLog = &log로 설정하면 edgeCollapse / 병렬 엔진이
+ * beginCollapse / endCollapse를 호출 (직접 호출할 필요 없음)
+ */
+class ProgressiveMesh
+{
+public:
+  std::vector<PMVertex> baseVertices;  // build 시점 vertex attribute
+  std::vector<glm::vec3> baseNormals;  // build 시점 vertex normal
+  std::vector<uint32_t> baseCorners;   // build 시점 face의 vertex id (face당 3개)
+  std::vector<PMCollapse> collapses;   // collapse 순서대로
+  std::vector<int> corners;            // PMCollapse::firstCorner / cornerCount가 가리키는 corner
+
+  /**
+   * Store the base mesh and reset the log
+   *
+   * @param mesh build 직후 메시 (compact / simplification 전이어야 함)
+   * @return 성공 여부 (이미 compact된 mesh이면 false)
+   */
+  bool begin(const Mesh &mesh);
+
+  /**
+   * Record a collapse before it is applied
+   *
+   * @param mesh 메시 데이터 (collapse 전)
+   * @param edge collapse할 edge
+   * @return 기록 index (endCollapse에 전달)
+   */
+  int beginCollapse(const Mesh &mesh, const Edge &edge);
+
+  /**
+   * Complete a record after the collapse is applied
+   *
+   * @param mesh 메시 데이터 (collapse 후)
+   * @param record beginCollapse가 반환한 index
+   * @param v1 남은 vertex (현재 mesh index)
+   * @param liveFaces collapse 후 face 수
+   */
+  void endCollapse(const Mesh &mesh, int record, int v1, int liveFaces);
+
+  int baseFaceCount() const { return (int)baseCorners.size() / 3; }
+
+  // level (적용한 collapse 수)의 face 수
+  int facesAtLevel(int level) const
+  {
+    return level == 0 ? baseFaceCount() : collapses[level - 1].liveFaces;
+  }
+
+  /**
+   * Smallest level whose face count is at most targetFaces
+   *
+   * @return level (기록된 collapse로 도달할 수 없으면 마지막 level)
+   */
+  int levelForFaces(int targetFaces) const;
+
+  // 기록에 사용 중인 메모리 (bytes, base 제외)
+  size_t logBytes() const
+  {
+    return collapses.size() * sizeof(PMCollapse) + corners.size() * sizeof(int);
+  }
+};
+
+/**
+ * Replay position in a progressive mesh
+ *
+ * setLevel()은 현재 level에서 목표 level까지의 collapse / split만 적용하므로
+ * 여러 LOD를 순서대로 꺼내면 전체 비용은 log 길이에 비례
+ */
+class ProgressiveMeshCursor
+{
+public:
+  explicit ProgressiveMeshCursor(const ProgressiveMesh &log);
+
+  // level 0 = base mesh, level n = collapse n개 적용
+  void setLevel(int level);
+  int level() const { return current; }
+
+  /**
+   * Write the current LOD as a mesh (vertices + live faces, saveGLB 용)
+   *
+   * edge / incidence는 만들지 않음
+   *
+   * @param out [out] 메시
+   */
+  void extract(Mesh &out) const;
+
+private:
+  const ProgressiveMesh &log;
+  int current = 0;
+  std::vector<PMVertex> vertices;
+  std::vector<uint32_t> corners;
+};
+
+#endif // PROGRESSIVE_MESH_H
@@ -9,10 +9,12 @@
  * 참고 논문:
  * Garland, M., & Heckbert, P. S. (1997).
  * "Surface simplification using quadric error metrics." SIGGRAPH 97.
+ * Lindstrom, P., & Turk, G. (1998).
+ * "Fast and memory efficient polygonal simplification." IEEE Visualization 98. (memoryless 모드)
  *
  * 주요 개선 사항:
  * 1. 인접 edge cost 재계산 완전 구현
- * 2. Singular matrix 처리 개선 (3-way candidate test)
+ * 2. Singular matrix 처리 개선 (edge segment 위 최소점)
  * 3. 수치 안정성 개선 (epsilon 비교)
  * 4. Optimal position 기반 attribute 보간
  * 5. 중복 계산 방지
@@ -26,18 +28,82 @@
 // 수치 안정성을 위한 epsilon
 const float QEM_EPSILON = 1e-10f;
 
+// Optimal position solver의 상대 conditioning 허용치 (|det(A)| / trace(A)^3)
+const float QEM_CONDITION_TOLERANCE = 1e-5f;
+
+// Memoryless 모드 cost의 volume / boundary 항 가중치 (Lindstrom-Turk 기본값)
+const float MEMORYLESS_VOLUME_WEIGHT = 0.5f;
+const float MEMORYLESS_BOUNDARY_WEIGHT = 0.5f;
+
+// Memoryless 모드 cost의 triangle shape 항 가중치
+// - 평면 영역에서는 volume / boundary cost가 모두 0이라 같은 vertex로 collapse가 몰려 valence가 폭증함
+// - tie-breaker 정도로만 작게: 크면 곡면에서 volume 항을 덮어 형상이 뭉개짐
+const float MEMORYLESS_SHAPE_WEIGHT = 1e-8f;
+
+// Memoryless 모드에서 새 선형 조건이 기존 조건과 이루어야 하는 최소 각도 (degree)
+const float MEMORYLESS_CONSTRAINT_ALPHA = 1.f;
+
 /**
  * Compute collapse cost for an edge
  *
  * QEM 공식을 사용하여 edge collapse 비용 계산:
  * 1. Q_edge = Q_v1 + Q_v2 (quadric 합산)
- * 2. 최적 위치 v* = argmin(v^T · Q · v)
+ * 2. 최적 위치 v* = argmin(v^T · Q · v) (closed-form 3x3 solve)
+ *    - ill-conditioned이면 edge segment [v1, v2] 위의 최소점으로 fallback
  * 3. Cost = v*^T · Q · v*
  *
- * @param edge 계산할 edge (cost와 optimalPosition이 업데이트됨)
+ * @param edge 계산할 edge
  * @param vertices 메시의 모든 vertex (각 vertex는 quadric을 가짐)
+ * @return collapse cost와 optimal position (호출자가 mesh.edgeCosts에 저장)
+ */
+EdgeCost computeCost(const Edge &edge, const VertexStore &vertices);
+
+/**
+ * Compute collapse cost without stored quadrics (memoryless, Lindstrom-Turk)
+ *
+ * v1, v2에 현재 인접한 face / boundary edge로 매번 새로 계산:
+ * - Volume 항: face마다 v를 옮길 때 쓸고 지나가는 tetrahedron 부피의 제곱
+ * - Boundary 항: boundary edge마다 쓸고 지나가는 삼각형 면적의 제곱 · |edge|^2
+ * - Shape 항: collapse 후 one-ring vertex까지 거리^2의 합 · |edge|^4
+ * - Cost = MEMORYLESS_VOLUME_WEIGHT · Σ 부피^2 + MEMORYLESS_BOUNDARY_WEIGHT · Σ 면적^2 · |edge|^2
+ *          + MEMORYLESS_SHAPE_WEIGHT · Σ 거리^2 · |edge|^4
+ *
+ * 위치는 선형 조건 a · v = b를 우선순위 순서로 모아 3개가 되면 결정:
+ * 1. Volume 보존: 부피 변화의 합 = 0
+ * 2. Boundary 보존: boundary 면적 vector 변화 = 0 (최대 2개)
+ * 3. Cost 최적화: cost의 최소점
+ * 4. Triangle shape 최적화: shape 항만의 최소점 (평면 영역처럼 남은 자유도)
+ * 기존 조건과 MEMORYLESS_CONSTRAINT_ALPHA보다 가까운 (거의 종속인) 조건은 버림
+ * - 조건이 3개 모이지 않으면 edge segment [v1, v2] 위의 최소점으로 fallback
+ *
+ * 비용은 O(valence), vertex quadric을 읽지 않으므로 vertices.quadrics가 없어도 됨
+ *
+ * @param edge 계산할 edge
+ * @param mesh 메시 데이터 (incidence index가 생성되어 있어야 함)
+ * @return collapse cost와 optimal position
  */
-void computeCost(Edge &edge, const std::vector<Vertex> &vertices);
+EdgeCost computeCostMemoryless(const Edge &edge, const Mesh &mesh);
+
+/**
+ * Compute collapse cost with the mesh's quadric mode
+ *
+ * mesh.quadricUpdate == QUADRIC_MEMORYLESS이면 computeCostMemoryless, 아니면 computeCost
+ */
+EdgeCost computeEdgeCost(const Edge &edge, const Mesh &mesh);
+
+/**
+ * Collect edges whose cached cost changes after a collapse into a vertex
+ *
+ * - Accumulate / recompute: cost는 양 끝점 quadric에만 의존 → vertexIndex의 edge
+ * - Memoryless: cost는 양 끝점 주변 face / boundary edge에 의존 → vertexIndex의 one-ring
+ *   vertex에 닿는 모든 edge (vertexIndex 자신의 edge 포함)
+ * 같은 edge가 여러 번 추가될 수 있음 (중복 제거는 호출자)
+ *
+ * @param mesh 메시 데이터
+ * @param vertexIndex collapse 후 남은 vertex (v1)
+ * @param edges edge 인덱스를 추가할 목록
+ */
+void collectStaleEdges(const Mesh &mesh, int vertexIndex, std::vector<int> &edges);
 
 /**
  * Compute quadric matrix for a vertex
@@ -52,7 +118,18 @@ void computeCost(Edge &edge, const std::vector<Vertex> &vertices);
  * @param vertices 메시의 모든 vertex
  * @param faces 메시의 모든 face
  */
-void computeQuadric(int vertexIndex, std::vector<Vertex> &vertices, const std::vector<Face> &faces);
+void computeQuadric(int vertexIndex, VertexStore &vertices, const std::vector<Face> &faces);
+
+/**
+ * Compute quadric matrix for a vertex using the incidence index
+ *
+ * mesh.vertexFaces[vertexIndex]의 face만 순회 (O(valence))
+ * 전체 face를 순회하는 위 버전과 결과는 동일
+ *
+ * @param vertexIndex 계산할 vertex의 인덱스
+ * @param mesh 메시 데이터 (incidence index가 생성되어 있어야 함)
+ */
+void computeQuadric(int vertexIndex, Mesh &mesh);
 
 /**
  * Compute all vertex quadrics efficiently (O(F) instead of O(V*F))
@@ -63,39 +140,73 @@ void computeQuadric(int vertexIndex, std::vector<Vertex> &vertices, const std::v
  * @param vertices 메시의 모든 vertex
  * @param faces 메시의 모든 face
  */
-void computeAllQuadrics(std::vector<Vertex> &vertices, const std::vector<Face> &faces);
+void computeAllQuadrics(VertexStore &vertices, const std::vector<Face> &faces);
 
 /**
  * Edge collapse operation (완전 수정 버전)
  *
  * Edge를 collapse하여 vertex를 병합:
- * 1. 새로운 vertex 위치 = edge.optimalPosition
+ * 1. 새로운 vertex 위치 = mesh.edgeCosts[edge].optimalPosition
  * 2. 영향받는 face들 업데이트
  * 3. Degenerate face 제거 (area=0 면)
- * 4. v1의 quadric 재계산
- * 5. v1과 인접한 모든 edge의 cost 재계산
+ * 4. v1 edge의 boundary flag 갱신 (병합 후 인접 face 수로 다시 판단)
+ * 5. v1의 quadric 갱신 (mesh.quadricUpdate: Q1 + Q2 또는 인접 face로 재계산)
+ * 6. collectStaleEdges의 edge cost 재계산 (mesh.edgeCosts, priority queue 갱신용)
+ *
+ * mesh.vertexFaces / mesh.vertexEdges를 통해 v1, v2의 one-ring만 순회하므로
+ * collapse 비용은 메시 크기가 아닌 vertex valence에 비례
+ * - v2의 edge가 v1의 기존 edge와 겹치면 (같은 반대편 vertex) 중복 edge로 삭제
+ * - mesh.collapseLog가 있으면 collapse를 progressive mesh log에 기록
  *
  * @param mesh 메시 데이터 (vertices, faces, edges가 수정됨)
  * @param edge collapse할 edge
+ * @param removedEdges (optional) 삭제된 edge 인덱스를 추가 (priority queue 갱신용)
+ * @param updatedEdges (optional) cost를 재계산한 edge 인덱스를 중복 없이 추가 (priority queue 갱신용)
+ * @return 삭제된 (degenerate) face 수
+ */
+int edgeCollapse(Mesh &mesh, Edge &edge, std::vector<int> *removedEdges = nullptr,
+                 std::vector<int> *updatedEdges = nullptr);
+
+/**
+ * Edge collapse without shared state updates
+ *
+ * edgeCollapse()와 동일하지만 mesh.deletedVertices / mesh.deletedFaces를 갱신하지 않음
+ * (mesh.changes / mesh.collapseLog도 기록하지 않음: 호출자가 collapse 전후에 기록)
+ * - v1, v2와 그 이웃 vertex들 (one-ring) 외에는 읽거나 쓰지 않음
+ * - one-ring이 서로 겹치지 않는 edge들에 대해 여러 thread에서 동시에 호출 가능
+ *   (호출자가 collapse 수와 반환값의 합만큼 두 counter를 갱신해야 함)
+ * - edge cost를 갱신하지 않음: cached cost를 쓰는 호출자 (heap 기반 엔진)는 모든 collapse가
+ *   끝난 뒤 collectStaleEdges(mesh, v1)의 edge를 (batch 전체에서 중복 제거 후) 재계산해야 함
+ *   (multiple-choice처럼 cost를 매번 새로 계산하는 호출자는 생략)
+ *
+ * @param mesh 메시 데이터
+ * @param edge collapse할 edge
+ * @param removedEdges (optional) 삭제된 edge 인덱스를 추가
+ * @return 삭제된 (degenerate) face 수
  */
-void edgeCollapse(Mesh &mesh, Edge &edge);
+int edgeCollapseLocal(Mesh &mesh, Edge &edge, std::vector<int> *removedEdges = nullptr);
 
 /**
- * Initialize all vertex quadrics
+ * Initialize all vertex quadrics (parallel)
  * 
  * 메시 simplification 시작 전 모든 vertex의 초기 quadric 계산
+ * - incidence index를 이용한 face → vertex gather: vertex마다 독립적으로 계산하므로
+ *   lock이나 per-thread reduction 없이 병렬화 가능
  * 
  * @param mesh 메시 데이터
+ * @param numThreads thread 수 (0: hardware concurrency)
  */
-void initializeQuadrics(Mesh &mesh);
+void initializeQuadrics(Mesh &mesh, int numThreads = 0);
 
 /**
- * Initialize all edge costs
+ * Initialize all edge costs (parallel)
  * 
- * 메시 simplification 시작 전 모든 edge의 초기 cost 계산
+ * 메시 simplification 시작 전 모든 edge의 초기 cost 계산 (computeEdgeCost)
+ * - edge마다 독립적 (vertex quadric / face는 읽기 전용)
  * 
  * @param mesh 메시 데이터
+ * @param numThreads thread 수 (0: hardware concurrency)
  */
-void initializeEdgeCosts(Mesh &mesh);
+void initializeEdgeCosts(Mesh &mesh, int numThreads = 0);
 
 #endif // QEM_H
\ No newline at end of file
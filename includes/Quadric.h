@@ -0,0 +1,215 @@
+#ifndef QUADRIC_H
+#define QUADRIC_H
+
+/**
+ * Quadric.h
+ *
+ * QEM quadric error matrix (4x4 symmetric → 10 coefficients)
+ *
+ *       | a2 ab ac ad |
+ *   Q = | ab b2 bc bd |      error(v) = v^T · Q · v,  v = [x, y, z, 1]^T
+ *       | ac bc c2 cd |
+ *       | ad bd cd d2 |
+ *
+ * - glm::mat4 (64 bytes) 대신 대칭 성분 10개만 저장 (40 bytes)
+ * - evaluate: 4x4 mat-vec 대신 ~20 FLOPs
+ */
+
+#include <glm/glm.hpp>
+#include <cmath>
+#include <algorithm>
+
+// Edge collapse 후 남는 vertex (v1)의 quadric 갱신 방식
+enum QuadricUpdate
+{
+  QUADRIC_ACCUMULATE, // Q1 + Q2 (Garland-Heckbert, O(1), 삭제된 face의 plane도 계속 반영)
+  QUADRIC_RECOMPUTE,  // v1에 인접한 face들의 plane으로 다시 합산 (O(valence))
+  QUADRIC_MEMORYLESS  // quadric을 저장하지 않음: edge cost를 현재 인접 face로 매번 계산 (Lindstrom-Turk)
+};
+
+class Quadric
+{
+public:
+  float a2, ab, ac, ad;
+  float b2, bc, bd;
+  float c2, cd;
+  float d2;
+
+  // Zero quadric
+  Quadric()
+      : a2(0.f), ab(0.f), ac(0.f), ad(0.f),
+        b2(0.f), bc(0.f), bd(0.f),
+        c2(0.f), cd(0.f),
+        d2(0.f) {}
+
+  /**
+   * Fundamental quadric of a plane: Kp = p · p^T
+   *
+   * @param plane [a, b, c, d] for ax + by + cz + d = 0
+   */
+  explicit Quadric(const glm::vec4 &plane)
+      : a2(plane.x * plane.x), ab(plane.x * plane.y), ac(plane.x * plane.z), ad(plane.x * plane.w),
+        b2(plane.y * plane.y), bc(plane.y * plane.z), bd(plane.y * plane.w),
+        c2(plane.z * plane.z), cd(plane.z * plane.w),
+        d2(plane.w * plane.w) {}
+
+  Quadric &operator+=(const Quadric &q)
+  {
+    a2 += q.a2; ab += q.ab; ac += q.ac; ad += q.ad;
+    b2 += q.b2; bc += q.bc; bd += q.bd;
+    c2 += q.c2; cd += q.cd;
+    d2 += q.d2;
+    return *this;
+  }
+
+  Quadric operator+(const Quadric &q) const
+  {
+    Quadric result = *this;
+    result += q;
+    return result;
+  }
+
+  Quadric &operator*=(float s)
+  {
+    a2 *= s; ab *= s; ac *= s; ad *= s;
+    b2 *= s; bc *= s; bd *= s;
+    c2 *= s; cd *= s;
+    d2 *= s;
+    return *this;
+  }
+
+  Quadric operator*(float s) const
+  {
+    Quadric result = *this;
+    result *= s;
+    return result;
+  }
+
+  /**
+   * Quadric error at position v: v^T · Q · v (w = 1)
+   *
+   * 항들이 서로 상쇄되므로 (계수는 |d|^2 크기, 결과는 거리^2 크기) double로 합산하고
+   * 반올림으로 생긴 음수는 0으로 clamp - Q1 + Q2 누적으로 계수가 커지면 float 합산은
+   * 음수 cost를 만들어 같은 vertex만 반복해서 collapse됨
+   *
+   * @param v 평가할 위치
+   * @return quadric error
+   */
+  float evaluate(const glm::vec3 &v) const
+  {
+    double x = v.x, y = v.y, z = v.z;
+    double error = x * (a2 * x + 2.0 * ((double)ab * y + (double)ac * z + ad)) +
+                   y * (b2 * y + 2.0 * ((double)bc * z + bd)) +
+                   z * (c2 * z + 2.0 * cd) +
+                   d2;
+    return (float)std::max(error, 0.0);
+  }
+
+  /**
+   * Optimal position: argmin v^T · Q · v
+   *
+   * 상위 3x3 블록 A와 b = [ad, bd, cd]^T 에 대해 A · v = -b 를 풂 (solveA)
+   * - Conditioning: |det(A)| <= tolerance · trace(A)^3 이면 ill-conditioned로 판단
+   *   (A는 PSD → det = λ1·λ2·λ3, trace = λ1+λ2+λ3 이므로 메시 scale과 무관한 상대 비교)
+   *
+   * @param out 최적 위치 (성공 시에만 기록)
+   * @param tolerance 상대 conditioning 허용치
+   * @return A가 well-conditioned이면 true
+   */
+  bool optimalPoint(glm::vec3 &out, float tolerance) const
+  {
+    // v = -A^-1 · b
+    return solveA(-glm::vec3(ad, bd, cd), out, tolerance);
+  }
+
+  /**
+   * Quadric of the squared distance to the line through a and b, scaled by |b - a|^2
+   *
+   * error(v) = |(b - a) × (v - a)|^2 = (v - a)^T · M · (v - a),  M = |e|^2 · I - e · e^T
+   * (memoryless 모드의 boundary 항: (2 · 삼각형 (v, a, b) 면적)^2)
+   */
+  static Quadric line(const glm::vec3 &a, const glm::vec3 &b)
+  {
+    glm::vec3 e = b - a;
+    float len2 = glm::dot(e, e);
+
+    Quadric q;
+    q.a2 = len2 - e.x * e.x; q.ab = -e.x * e.y; q.ac = -e.x * e.z;
+    q.b2 = len2 - e.y * e.y; q.bc = -e.y * e.z;
+    q.c2 = len2 - e.z * e.z;
+
+    glm::vec3 Ma = q.multiplyA(a);
+    q.ad = -Ma.x; q.bd = -Ma.y; q.cd = -Ma.z;
+    q.d2 = glm::dot(a, Ma);
+    return q;
+  }
+
+  /**
+   * Optimal position restricted to segment [p1, p2]
+   *
+   * A가 singular / ill-conditioned일 때의 fallback
+   * v(t) = p1 + t·(p2 - p1) 에서 error는 t에 대한 볼록 2차식이므로
+   * 극소점 t* = -d·(A·p1 + b) / (d·A·d) 를 [0, 1]로 clamp
+   *
+   * @param p1, p2 edge 양 끝점 위치
+   * @param out 최적 위치
+   * @return out에서의 quadric error
+   */
+  float optimalPointOnSegment(const glm::vec3 &p1, const glm::vec3 &p2, glm::vec3 &out) const
+  {
+    glm::vec3 d = p2 - p1;
+    glm::vec3 Ad = multiplyA(d);
+    float curvature = glm::dot(d, Ad);
+
+    float t = 0.5f;
+    if (curvature > 0.f)
+    {
+      glm::vec3 gradient = multiplyA(p1) + glm::vec3(ad, bd, cd);
+      t = glm::clamp(-glm::dot(d, gradient) / curvature, 0.f, 1.f);
+    }
+
+    out = p1 + d * t;
+    return evaluate(out);
+  }
+
+private:
+  /**
+   * Solve A · v = rhs (상위 3x3 블록)
+   *
+   * - A는 대칭이므로 cofactor 6개만으로 Cramer's rule 적용 (closed form)
+   * - Conditioning: |det(A)| <= tolerance · trace(A)^3 이면 ill-conditioned로 판단
+   */
+  bool solveA(const glm::vec3 &rhs, glm::vec3 &out, float tolerance) const
+  {
+    // Cofactors of symmetric A
+    float c00 = b2 * c2 - bc * bc;
+    float c01 = ac * bc - ab * c2;
+    float c02 = ab * bc - ac * b2;
+    float c11 = a2 * c2 - ac * ac;
+    float c12 = ab * ac - a2 * bc;
+    float c22 = a2 * b2 - ab * ab;
+
+    float det = a2 * c00 + ab * c01 + ac * c02;
+    float trace = a2 + b2 + c2;
+    if (!(std::abs(det) > tolerance * trace * trace * trace))
+      return false;
+
+    // v = adj(A) · rhs / det
+    float invDet = 1.f / det;
+    out = glm::vec3(c00 * rhs.x + c01 * rhs.y + c02 * rhs.z,
+                    c01 * rhs.x + c11 * rhs.y + c12 * rhs.z,
+                    c02 * rhs.x + c12 * rhs.y + c22 * rhs.z) *
+          invDet;
+    return true;
+  }
+
+  // A · v (상위 3x3 블록)
+  glm::vec3 multiplyA(const glm::vec3 &v) const
+  {
+    return glm::vec3(a2 * v.x + ab * v.y + ac * v.z,
+                     ab * v.x + b2 * v.y + bc * v.z,
+                     ac * v.x + bc * v.y + c2 * v.z);
+  }
+};
+
+#endif // QUADRIC_H
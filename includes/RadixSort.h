@@ -0,0 +1,110 @@
+#ifndef RADIXSORT_H
+#define RADIXSORT_H
+
+/**
+ * RadixSort.h
+ *
+ * 병렬 LSD radix sort (64-bit key, 선택적으로 int value를 함께 이동)
+ * - 8-bit digit씩 최대 8 pass, 모든 key에서 같은 digit인 pass는 건너뜀
+ * - 한 pass: chunk별 histogram (병렬) → (digit, chunk) 순서로 prefix sum → chunk별 scatter (병렬)
+ * - stable: key가 같으면 입력 순서 유지
+ *
+ * vertex welding (Morton key), edge 추출 (vertex 쌍 key) 등 정렬 기반 build 단계에서 사용
+ */
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "Parallel.h"
+
+const int RADIX_BITS = 8;
+const int RADIX_BUCKETS = 1 << RADIX_BITS;
+
+/**
+ * Sort keys (values가 nullptr가 아니면 (key, value) 쌍으로 정렬)
+ *
+ * @param keys 정렬할 key (in-place)
+ * @param values key와 같은 순서로 함께 이동할 값 (nullptr: key만 정렬)
+ * @param numThreads thread 수 (0: hardware concurrency)
+ */
+inline void radixSort(std::vector<uint64_t> &keys, std::vector<int> *values, int numThreads = 0)
+{
+  const int count = (int)keys.size();
+  if (count <= 1)
+    return;
+
+  // chunk 수 = thread 수 (chunk가 너무 작으면 줄임)
+  int chunks = std::min(resolveThreadCount(numThreads), (count + PARALLEL_MIN_CHUNK - 1) / PARALLEL_MIN_CHUNK);
+  chunks = std::max(chunks, 1);
+  const int chunkSize = (count + chunks - 1) / chunks;
+
+  std::vector<uint64_t> keysTmp(count);
+  std::vector<int> valuesTmp(values ? count : 0);
+  std::vector<size_t> histogram((size_t)chunks * RADIX_BUCKETS);
+
+  for (int shift = 0; shift < 64; shift += RADIX_BITS)
+  {
+    // 1. chunk별 digit histogram
+    std::fill(histogram.begin(), histogram.end(), 0);
+    parallelFor(0, chunks, [&](int c)
+    {
+      size_t *h = &histogram[(size_t)c * RADIX_BUCKETS];
+      int end = std::min(count, (c + 1) * chunkSize);
+      for (int i = c * chunkSize; i < end; i++)
+        h[(keys[i] >> shift) & (RADIX_BUCKETS - 1)]++;
+    }, chunks, 1);
+
+    // 모든 key가 같은 digit이면 이 pass는 순서를 바꾸지 않음
+    int firstDigit = (int)((keys[0] >> shift) & (RADIX_BUCKETS - 1));
+    size_t firstDigitCount = 0;
+    for (int c = 0; c < chunks; c++)
+      firstDigitCount += histogram[(size_t)c * RADIX_BUCKETS + firstDigit];
+    if (firstDigitCount == (size_t)count)
+      continue;
+
+    // 2. Exclusive prefix sum: digit 순서 → 같은 digit 안에서는 chunk 순서 (stable)
+    size_t offset = 0;
+    for (int d = 0; d < RADIX_BUCKETS; d++)
+    {
+      for (int c = 0; c < chunks; c++)
+      {
+        size_t &slot = histogram[(size_t)c * RADIX_BUCKETS + d];
+        size_t digitCount = slot;
+        slot = offset;
+        offset += digitCount;
+      }
+    }
+
+    // 3. chunk별 scatter
+    parallelFor(0, chunks, [&](int c)
+    {
+      size_t *h = &histogram[(size_t)c * RADIX_BUCKETS];
+      int end = std::min(count, (c + 1) * chunkSize);
+      for (int i = c * chunkSize; i < end; i++)
+      {
+        size_t dst = h[(keys[i] >> shift) & (RADIX_BUCKETS - 1)]++;
+        keysTmp[dst] = keys[i];
+        if (values)
+          valuesTmp[dst] = (*values)[i];
+      }
+    }, chunks, 1);
+
+    keys.swap(keysTmp);
+    if (values)
+      values->swap(valuesTmp);
+  }
+}
+
+// Sort (key, value) pairs by key
+inline void radixSortPairs(std::vector<uint64_t> &keys, std::vector<int> &values, int numThreads = 0)
+{
+  radixSort(keys, &values, numThreads);
+}
+
+// Sort keys only
+inline void radixSortKeys(std::vector<uint64_t> &keys, int numThreads = 0)
+{
+  radixSort(keys, nullptr, numThreads);
+}
+
+#endif // RADIXSORT_H
@@ -0,0 +1,223 @@
+#ifndef SIMPLIFY_H
+#define SIMPLIFY_H
+
+/**
+ * Simplify.h
+ *
+ * QEM 기반 메시 simplification 엔진
+ * - Greedy: 전역 최소 cost edge를 하나씩 collapse (Garland & Heckbert)
+ * - Parallel: one-ring이 겹치지 않는 저비용 edge들을 batch로 모아 동시에 collapse
+ * - Multiple-choice: 무작위 후보 k개 중 최소 cost edge를 collapse (전역 heap 없음)
+ *
+ * Greedy / parallel 엔진은 같은 EdgeHeap을 사용하므로 호출 사이에 모드를 바꿔도 상태가 유지됨
+ * (multiple-choice 엔진은 heap을 갱신하지 않으므로, 이후 heap을 쓰려면 다시 초기화해야 함)
+ *
+ * simplify(): 목표 face 수 / 비율 / 최대 error / 시간 제한으로 한 번에 단순화하는 entry point
+ * compactIfNeeded(): 삭제된 entry 비율이 threshold를 넘으면 mesh를 compact하고 heap의 edge id 갱신
+ */
+
+#include "Mesh.h"
+#include "EdgeHeap.h"
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+
+// Multiple-choice 엔진의 기본 후보 수
+const int MULTIPLE_CHOICE_CANDIDATES = 8;
+
+// 삭제된 face 비율이 이 값을 넘으면 mesh compaction
+const float MESH_COMPACT_THRESHOLD = 0.5f;
+
+// Simplification 엔진 종류
+enum SimplifyMethod
+{
+  GREEDY,         // 최소 cost edge를 하나씩 collapse
+  PARALLEL,       // one-ring이 겹치지 않는 edge들을 batch로 동시에 collapse
+  MULTIPLE_CHOICE // 무작위 후보 k개 중 최소 cost edge를 collapse (heap 없음)
+};
+
+/**
+ * 엔진 한 번 호출의 결과
+ */
+struct CollapseProgress
+{
+  int collapses = 0;    // 수행한 collapse 수
+  int removedFaces = 0; // 삭제된 face 수
+  float maxCost = 0.f;  // 수행한 collapse 중 최대 cost (quadric error)
+  bool exhausted = false; // 더 이상 collapse할 edge가 없음 (heap 소진 또는 maxCost 초과)
+  bool errorLimited = false; // exhausted의 원인이 maxCost 초과 (남은 edge는 있음)
+};
+
+/**
+ * Initialize edge queue
+ *
+ * 모든 edge의 cost를 병렬로 계산하고 heap을 bulk heapify로 생성
+ * (vertex quadric은 미리 계산되어 있어야 함)
+ *
+ * @param mesh 메시 데이터
+ * @param heap 초기화할 edge queue
+ * @param numThreads thread 수 (0: hardware concurrency)
+ */
+void initializeEdgeQueue(Mesh &mesh, EdgeHeap &heap, int numThreads = 0);
+
+/**
+ * Greedy simplification
+ *
+ * heap에서 최소 cost edge를 꺼내 collapse → 주변 edge의 heap key 갱신을 반복
+ *
+ * @param mesh 메시 데이터
+ * @param heap edge queue (initializeEdgeQueue로 초기화)
+ * @param maxCollapses 최대 collapse 수
+ * @param maxCost 최소 cost가 이 값을 넘으면 중지
+ * @return 수행 결과
+ */
+CollapseProgress greedySimplify(Mesh &mesh, EdgeHeap &heap, int maxCollapses,
+                                float maxCost = std::numeric_limits<float>::max());
+
+/**
+ * Parallel simplification (independent-set batches)
+ *
+ * 한 round마다:
+ * 1. heap에서 cost 순으로 edge를 꺼내, v1/v2의 one-ring이 이미 선택된 edge들과
+ *    겹치지 않으면 batch에 추가 (겹치면 round가 끝난 뒤 heap에 다시 넣음)
+ * 2. batch의 edge들을 thread들에서 동시에 collapse (edgeCollapseLocal)
+ *    - one-ring이 disjoint하므로 각 collapse가 읽고 쓰는 데이터가 겹치지 않음
+ * 3. 삭제된 edge 제거, v1 주변 edge의 heap key 갱신 (serial)
+ *
+ * batch 크기를 live vertex 수의 일부로 제한하여 greedy 순서와 크게 벗어나지 않게 함
+ *
+ * @param mesh 메시 데이터
+ * @param heap edge queue (initializeEdgeQueue로 초기화)
+ * @param maxCollapses 최대 collapse 수
+ * @param numThreads thread 수 (0: hardware concurrency)
+ * @param maxCost 최소 cost가 이 값을 넘으면 중지
+ * @return 수행 결과
+ */
+CollapseProgress parallelSimplify(Mesh &mesh, EdgeHeap &heap, int maxCollapses, int numThreads = 0,
+                                  float maxCost = std::numeric_limits<float>::max());
+
+/**
+ * Multiple-choice randomized simplification (no global heap)
+ *
+ * Wu & Kobbelt 방식: 매 collapse마다 live edge k개를 무작위로 뽑아 computeEdgeCost로 평가하고
+ * 그 중 최소 cost edge를 collapse. 전역 priority queue를 유지하지 않으므로 heap 메모리가 없음
+ *
+ * 여러 collapse를 한 round로 묶어 병렬화:
+ * 1. 후보 그룹마다 (thread별로 독립적으로) k개를 샘플링 → 그룹별 최소 cost edge 선택
+ * 2. one-ring이 겹치지 않는 승자들만 동시에 collapse (parallelSimplify와 동일한 조건)
+ * 그룹별 난수열은 (seed, round, group)으로 결정되므로 결과는 thread 수와 무관
+ *
+ * 전역 최소 cost를 알 수 없으므로 maxCost는 근사적으로 적용됨
+ * (한 round의 모든 승자가 maxCost를 넘으면 중지)
+ *
+ * @param mesh 메시 데이터 (vertex quadric이 계산되어 있어야 함)
+ * @param maxCollapses 최대 collapse 수
+ * @param seed 난수 seed (호출마다 바꾸면 서로 다른 샘플 사용)
+ * @param candidates collapse 하나당 샘플링할 후보 edge 수 (k)
+ * @param numThreads thread 수 (0: hardware concurrency)
+ * @param maxCost 이 값을 넘는 후보는 collapse하지 않음
+ * @return 수행 결과
+ */
+CollapseProgress multipleChoiceSimplify(Mesh &mesh, int maxCollapses, uint32_t seed,
+                                        int candidates = MULTIPLE_CHOICE_CANDIDATES, int numThreads = 0,
+                                        float maxCost = std::numeric_limits<float>::max());
+
+/**
+ * Compact mesh if the dead fraction exceeds threshold
+ *
+ * mesh.deadFraction() > threshold이면 Mesh::compact()를 호출하고
+ * heap이 주어지면 바뀐 edge id로 heap을 갱신 (heap 순서는 유지됨)
+ * 엔진 호출 사이에만 호출해야 함 (엔진 내부에서 edge / vertex id를 들고 있음)
+ *
+ * @param mesh 메시 데이터
+ * @param heap (optional) mesh의 edge queue
+ * @param threshold 삭제된 face 비율 기준 (0 이하: 항상 compact)
+ * @param numThreads thread 수 (0: hardware concurrency)
+ * @return compaction 수행 여부
+ */
+bool compactIfNeeded(Mesh &mesh, EdgeHeap *heap, float threshold = MESH_COMPACT_THRESHOLD, int numThreads = 0);
+
+/**
+ * simplify() 옵션
+ *
+ * 중지 조건은 가장 먼저 만족되는 것이 적용됨
+ * (face 목표가 없으면 maxError / 시간 제한 / 더 이상 collapse할 수 없을 때까지 진행)
+ */
+struct SimplifyOptions
+{
+  SimplifyMethod method = GREEDY;
+  int targetFaceCount = 0;  // 목표 face 수 (0: 사용 안 함)
+  float targetRatio = 0.f;  // 목표 face 비율 (시작 face 수 대비, 0: 사용 안 함)
+  float maxError = std::numeric_limits<float>::max(); // collapse cost 상한 (quadric error)
+  double timeBudget = 0.0;  // 전체 시간 제한 (초, 0: 무제한)
+  int numThreads = 0;       // thread 수 (0: hardware concurrency)
+  int candidates = MULTIPLE_CHOICE_CANDIDATES; // Multiple-choice 후보 수
+  uint32_t seed = 0;        // Multiple-choice 난수 seed
+  float compactThreshold = MESH_COMPACT_THRESHOLD; // 삭제된 face 비율이 넘으면 compaction (0: 사용 안 함)
+  QuadricUpdate quadricUpdate = QUADRIC_ACCUMULATE; // collapse 후 quadric 갱신 방식 (mesh.quadricUpdate로 설정)
+};
+
+// simplify() 중지 사유
+enum SimplifyStopReason
+{
+  STOP_TARGET_REACHED, // 목표 face 수 / 비율 도달
+  STOP_MAX_ERROR,      // 다음 collapse cost가 maxError 초과
+  STOP_TIME_BUDGET,    // 시간 제한 초과
+  STOP_EXHAUSTED       // 더 이상 collapse할 edge 없음
+};
+
+/**
+ * simplify() 결과 통계
+ */
+struct SimplifyStats
+{
+  int collapses = 0;      // 수행한 collapse 수
+  int compactions = 0;    // 수행한 mesh compaction 수
+  int initialFaces = 0;   // 시작 face 수
+  int finalFaces = 0;     // 종료 face 수
+  float finalError = 0.f; // 수행한 collapse 중 최대 cost (quadric error)
+  double quadricTime = 0.0;  // Vertex quadric 초기화 (ms)
+  double queueTime = 0.0;    // Edge cost 계산 + heap 생성 (ms)
+  double collapseTime = 0.0; // Edge collapse + compaction (ms)
+  SimplifyStopReason stopReason = STOP_TARGET_REACHED;
+};
+
+/**
+ * Simplify mesh in one call
+ *
+ * 1. Vertex quadric 초기화
+ * 2. Edge cost 계산 + heap 생성 (multiple-choice 제외)
+ * 3. 중지 조건을 만족할 때까지 선택한 엔진으로 collapse
+ *    (엔진 호출 사이에 삭제된 face 비율이 compactThreshold를 넘으면 compaction)
+ *
+ * GUI 없이 batch pipeline에서 정확한 triangle 예산을 맞출 때 사용
+ * (collapse 하나가 face를 1~2개 지우므로 결과는 목표보다 최대 1개 적을 수 있음)
+ *
+ * @param mesh 메시 데이터 (buildMesh 이후)
+ * @param options 엔진 및 중지 조건
+ * @return 통계
+ */
+SimplifyStats simplify(Mesh &mesh, const SimplifyOptions &options);
+
+/**
+ * Simplify caller-owned indexed buffers in place
+ *
+ * 파일이나 중간 배열 복사 없이 호출자의 position / index buffer를 직접 읽고 결과를 다시 씀
+ * (asset pipeline에 simplifier를 in-process로 포함할 때 사용)
+ * - vertex welding 없음: vertex index는 입력과 같게 유지됨
+ * - 살아남은 vertex의 위치는 원래 slot에 덮어씀 (삭제된 vertex slot은 그대로)
+ * - 살아남은 face는 indices 앞쪽 stats.finalFaces * 3개에 압축되어 기록됨
+ *   (중간에 compaction이 일어나도 Mesh::originalVertex로 입력 index를 복원)
+ *
+ * @param positions 첫 vertex의 x 좌표 (float xyz, 이후 다른 attribute가 interleave되어도 됨)
+ * @param positionStride vertex 간 byte 간격 (0: 3 * sizeof(float))
+ * @param numVertices vertex 개수
+ * @param indices triangle index 배열 (3개씩 한 face)
+ * @param numIndices index 개수
+ * @param options 엔진 및 중지 조건
+ * @return 통계
+ */
+SimplifyStats simplifyIndexed(float *positions, size_t positionStride, int numVertices,
+                              uint32_t *indices, int numIndices, const SimplifyOptions &options);
+
+#endif // SIMPLIFY_H
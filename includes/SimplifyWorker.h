@@ -0,0 +1,250 @@
+#ifndef SIMPLIFY_WORKER_H
+#define SIMPLIFY_WORKER_H
+
+/**
+ * SimplifyWorker.h
+ *
+ * Viewer용 background simplification worker
+ * - worker thread가 mesh 사본을 소유하고, 요청받은 단계 수만큼 simplify
+ * - 단계가 끝날 때마다 렌더링용 MeshSnapshot을 triple buffer로 게시 (lock-free handoff)
+ *   snapshot은 바뀐 vertex / face slot 범위만 담은 patch (Mesh::changes 기반)
+ * - render thread는 매 frame acquireSnapshot()으로 새 snapshot이 있는지만 확인하므로
+ *   simplification 중에도 렌더 루프가 멈추지 않음
+ * - 진행률 / live face 수는 atomic 값으로 노출 (window title 등에 표시)
+ * - Interactive 모드: render thread가 매 frame requestSlice()로 시간 제한이 있는 slice를 요청
+ *   → 목표 face 수까지 frame마다 조금씩 collapse (edge queue는 단계 / slice 사이에 유지)
+ */
+
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+#include <glm/gtc/type_precision.hpp>
+#include "Mesh.h"
+#include "EdgeHeap.h"
+#include "Simplify.h"
+
+// 한 단계를 이 수만큼 나눠 엔진을 호출하고 사이마다 진행률 갱신
+const int SIMPLIFY_WORKER_PROGRESS_CHUNKS = 16;
+
+// Slice 안에서 시계를 확인하는 간격 (엔진 한 번 호출의 최대 collapse 수)
+const int SIMPLIFY_WORKER_SLICE_CHUNK = 256;
+
+// Dirty slot 사이 간격이 이 이하이면 한 범위로 합침 (glBufferSubData 호출 수 감소)
+const int SNAPSHOT_RANGE_GAP = 16;
+
+// Dirty slot이 전체의 이 비율을 넘으면 patch 대신 전체 업로드
+const float SNAPSHOT_FULL_UPLOAD_FRACTION = 0.5f;
+
+/**
+ * GPU vertex format (interleaved, 20 bytes)
+ *
+ * - position: float3 (shader의 vec4 aPos는 w = 1로 채워짐)
+ * - color: normalized unsigned byte x4
+ * - texCoord: half float x2
+ */
+struct RenderVertex
+{
+  glm::vec3 position;
+  glm::u8vec4 color;
+  glm::u16vec2 texCoord;
+
+  void set(const glm::vec3 &p, const glm::vec4 &c, const glm::vec2 &uv)
+  {
+    position = p;
+    color = glm::u8vec4(glm::round(glm::clamp(c, 0.f, 1.f) * 255.f));
+    texCoord = glm::u16vec2(glm::packHalf1x16(uv.x), glm::packHalf1x16(uv.y));
+  }
+};
+static_assert(sizeof(RenderVertex) == 20, "RenderVertex must stay tightly packed");
+
+// 연속된 slot 범위 [first, first + count)
+struct SnapshotRange
+{
+  int first;
+  int count;
+};
+
+/**
+ * 렌더링용 mesh snapshot (GPU buffer patch, element buffer 형식)
+ *
+ * GPU buffer는 mesh slot과 1:1 (vertex slot → RenderVertex, face slot → index 3개)
+ * - full: buffer 전체 (처음 / compaction 후, slot 수가 바뀔 수 있음)
+ * - 그 외: 이전 snapshot 이후 바뀐 범위만 → 업로드 양이 collapse 수에 비례
+ * 삭제된 face는 index (0, 0, 0)인 degenerate triangle로 남음 (다음 compaction까지)
+ */
+struct MeshSnapshot
+{
+  bool full = true;
+  int vertexSlots = 0;                    // GPU vertex buffer 크기 (slot 수)
+  int faceSlots = 0;                      // GPU index buffer 크기 (face 수)
+  std::vector<SnapshotRange> vertexRanges;
+  std::vector<SnapshotRange> faceRanges;
+  std::vector<RenderVertex> vertices;     // vertexRanges 순서대로 이어붙인 데이터
+  std::vector<uint32_t> indices;          // faceRanges 순서대로 face당 3개
+  int liveVertices = 0;                   // 삭제되지 않은 vertex 수
+  int step = 0;                           // 이 snapshot까지 끝난 simplification 단계 수
+};
+
+/**
+ * Pack render data of the mesh into a snapshot (vector 용량은 재사용)
+ *
+ * 삭제된 vertex slot도 그대로 두므로 index 변환이 필요 없음
+ * (dead slot은 compactIfNeeded()의 mesh compaction으로 일정 비율 이하로 유지됨)
+ *
+ * @param mesh 메시 데이터
+ * @param dirtyVertices 정렬된 dirty vertex slot (nullptr: 전체)
+ * @param dirtyFaces 정렬된 dirty face slot (nullptr: 전체)
+ * @param out [out] snapshot
+ */
+void buildSnapshot(const Mesh &mesh, const std::vector<int> *dirtyVertices,
+                   const std::vector<int> *dirtyFaces, MeshSnapshot &out);
+
+/**
+ * Single-producer / single-consumer triple buffer
+ *
+ * slot 3개: writer 전용 (back), reader 전용 (front), 교환용 (shared)
+ * - publish(): back과 shared를 atomic exchange하고 fresh bit 설정
+ * - acquire(): fresh bit가 있으면 front와 shared를 exchange
+ * lock 없이 writer는 절대 기다리지 않고, reader는 항상 가장 최근에 게시된 snapshot을 얻음
+ */
+class SnapshotBuffer
+{
+public:
+  // Writer (worker thread): 채울 slot
+  MeshSnapshot &back() { return slots[backIndex]; }
+
+  // Writer: back slot 게시
+  void publish()
+  {
+    backIndex = shared.exchange(backIndex | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+  }
+
+  /**
+   * Reader (render thread): 새로 게시된 snapshot이 있으면 front로 가져옴
+   *
+   * @return 새 snapshot을 가져왔으면 true
+   */
+  bool acquire()
+  {
+    if ((shared.load(std::memory_order_relaxed) & FRESH) == 0)
+      return false;
+    frontIndex = shared.exchange(frontIndex, std::memory_order_acq_rel) & INDEX_MASK;
+    return true;
+  }
+
+  // Writer: 마지막으로 게시한 snapshot을 reader가 아직 가져가지 않았는지
+  // (false이면 이미 가져갔으므로 다음 snapshot은 그 이후의 변경만 담으면 됨)
+  bool unread() const { return (shared.load(std::memory_order_acquire) & FRESH) != 0; }
+
+  // Reader: 마지막으로 가져온 snapshot
+  const MeshSnapshot &front() const { return slots[frontIndex]; }
+
+private:
+  static const int FRESH = 4;      // shared slot이 아직 읽히지 않은 snapshot인지
+  static const int INDEX_MASK = 3; // slot index bits
+
+  MeshSnapshot slots[3];
+  int backIndex = 0;             // worker thread만 접근
+  int frontIndex = 1;            // render thread만 접근
+  std::atomic<int> shared{2};    // 교환용 slot index | FRESH
+};
+
+/**
+ * Background simplification worker
+ */
+class SimplifyWorker
+{
+public:
+  ~SimplifyWorker() { stop(); }
+
+  /**
+   * Take ownership of the mesh and start the worker thread
+   *
+   * 시작 전 mesh로 첫 snapshot을 게시하므로 바로 acquireSnapshot()할 수 있음
+   *
+   * @param source 메시 (vertex quadric이 계산되어 있어야 함, 이동됨)
+   * @param collapsesPerStep requestStep() 한 번에 수행할 collapse 수
+   */
+  void start(Mesh &&source, int collapsesPerStep);
+
+  // 진행 중인 단계가 끝나면 thread 종료 (남은 요청은 버림)
+  void stop();
+
+  // Simplification 단계 하나 요청 (render thread, 즉시 반환)
+  void requestStep();
+
+  /**
+   * Request a time-budgeted slice toward a target face count (render thread, 즉시 반환)
+   *
+   * 매 frame 호출: 이전 slice가 아직 진행 중이면 무시되므로 slice는 frame당 최대 하나
+   * slice가 끝나면 collapse가 있었을 때만 snapshot을 게시
+   *
+   * @param targetFaces 목표 face 수 (live face 수가 이하이면 아무것도 하지 않음)
+   * @param budgetMs slice 하나의 collapse 시간 제한 (ms)
+   */
+  void requestSlice(int targetFaces, double budgetMs);
+
+  // 이후 단계에서 사용할 엔진 (진행 중인 단계에는 영향 없음)
+  void setMethod(SimplifyMethod method) { methodValue.store(method, std::memory_order_relaxed); }
+
+  bool acquireSnapshot() { return snapshots.acquire(); }
+  const MeshSnapshot &snapshot() const { return snapshots.front(); }
+
+  // 처리 중이거나 대기 중인 단계 / slice가 있는지
+  bool busy() const
+  {
+    return pendingSteps.load(std::memory_order_relaxed) > 0 || sliceRequested.load(std::memory_order_relaxed);
+  }
+
+  // 현재 단계의 진행률 (0~1)
+  float progress() const { return progressValue.load(std::memory_order_relaxed); }
+
+  // 남은 (요청했지만 끝나지 않은) 단계 수
+  int pending() const { return pendingSteps.load(std::memory_order_relaxed); }
+
+  // Worker mesh의 live face 수 (진행 중인 단계 포함)
+  int liveFaces() const { return liveFaceCount.load(std::memory_order_relaxed); }
+
+private:
+  void run();
+  void simplifyStep();
+  bool simplifySlice(int targetFaces, double budgetMs);
+  void prepareQueue(SimplifyMethod method);
+  CollapseProgress runEngine(SimplifyMethod method, int maxCollapses);
+  void publishSnapshot();
+
+  // Worker thread 전용
+  Mesh mesh;
+  EdgeHeap heap;
+  uint32_t seed = 0;
+  int stepSize = 1;
+  int stepsDone = 0;
+
+  // 마지막으로 게시한 snapshot의 dirty slot (reader가 건너뛰면 다음 snapshot에 포함)
+  std::vector<int> publishedVertices;
+  std::vector<int> publishedFaces;
+  bool publishedFull = false;
+  std::vector<int> dirtyVertices; // publishSnapshot() scratch
+  std::vector<int> dirtyFaces;
+
+  std::thread thread;
+  std::mutex wakeMutex;             // 대기 / 깨우기 전용 (snapshot handoff에는 사용하지 않음)
+  std::condition_variable wake;
+  std::atomic<int> pendingSteps{0};
+  std::atomic<bool> stopping{false};
+  std::atomic<int> methodValue{GREEDY};
+  std::atomic<float> progressValue{0.f};
+  std::atomic<int> liveFaceCount{0};
+  std::atomic<bool> sliceRequested{false};
+  int sliceTarget = 0;       // requestSlice()가 sliceRequested를 설정하기 전에 기록
+  double sliceBudgetMs = 0.0;
+
+  SnapshotBuffer snapshots;
+};
+
+#endif // SIMPLIFY_WORKER_H
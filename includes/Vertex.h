@@ -4,43 +4,99 @@
 /**
  * Vertex.h
  *
- * 메시의 정점 (Mesh Vertex)
+ * 메시의 정점 저장소 (Structure of Arrays)
  * - Position: 3D 위치
- * - Normal: 정점 법선 (인접 면들의 평균)
- * - TexCoord: 텍스처 UV 좌표
- * - Color: 정점 색상 (texture 없을 때 사용)
- * - Quadric: QEM 알고리즘의 quadric error matrix (4x4 symmetric)
- * - AdjacentVertices: 인접 정점 인덱스 (토폴로지 관리용, 선택사항)
+ * - Quadric: QEM 알고리즘의 quadric error matrix (4x4 symmetric, 10 coefficients)
+ * - Normal / TexCoord / Color: 렌더링 / 출력용 attribute
+ * - Deleted: 삭제 flag (simplification)
+ *
+ * 속성마다 별도 배열로 저장하여 collapse / cost 계산처럼 position과 quadric만 쓰는 loop가
+ * 필요한 배열만 읽도록 함 (vertex당 89 bytes, vertex별 힙 할당 없음)
+ *
+ * Memoryless simplification은 quadric을 저장하지 않으므로 releaseQuadrics()로 배열을 해제할 수 있음
+ * (build 전에 호출하면 처음부터 할당하지 않음)
+ *
+ * 삭제 flag는 vertex당 1 byte: parallel collapse에서 여러 thread가 서로 다른 vertex를
+ * 동시에 삭제하므로, 한 word를 공유하는 bit 단위 flag는 쓸 수 없음
  */
 
-#include <iostream>
 #include <vector>
-#include <GL/glew.h>
-#include <GLFW/glfw3.h>
+#include <cstdint>
 #include <glm/glm.hpp>
-#include <glm/gtc/type_ptr.hpp>
+#include "Quadric.h"
 
-class Vertex
+class VertexStore
 {
 public:
-  glm::vec3 position;                // 3D position
-  glm::vec3 normal;                  // Vertex normal
-  glm::vec2 texCoord;                // Texture UV coordinates
-  glm::vec4 color;                   // Vertex color (RGBA)
-  std::vector<int> adjacentVertices; // Adjacent vertex indices (optional)
-  glm::mat4 quadric;                 // QEM quadric matrix Q (4x4)
-  bool isDeleted;                    // Vertex deletion flag (for simplification)
+  std::vector<glm::vec3> positions; // 3D position
+  std::vector<Quadric> quadrics;    // QEM quadric matrix Q (symmetric 4x4)
+  std::vector<glm::vec3> normals;   // Vertex normal
+  std::vector<glm::vec2> texCoords; // Texture UV coordinates
+  std::vector<glm::vec4> colors;    // Vertex color (RGBA)
+  std::vector<uint8_t> deleted;     // Vertex deletion flag (for simplification)
+  bool hasQuadrics = true;          // false: quadrics 배열을 유지하지 않음 (memoryless)
+
+  size_t size() const { return positions.size(); }
+  bool empty() const { return positions.empty(); }
+
+  void reserve(size_t count)
+  {
+    positions.reserve(count);
+    if (hasQuadrics)
+      quadrics.reserve(count);
+    normals.reserve(count);
+    texCoords.reserve(count);
+    colors.reserve(count);
+    deleted.reserve(count);
+  }
+
+  void clear()
+  {
+    positions.clear();
+    quadrics.clear();
+    normals.clear();
+    texCoords.clear();
+    colors.clear();
+    deleted.clear();
+  }
 
   /**
-   * Constructor
+   * Append vertex
    *
    * @param pos 정점 위치
    * @param norm 법선 벡터
    * @param uv 텍스처 좌표
    * @param col 색상
+   * @return 추가된 vertex의 index
    */
-  Vertex(const glm::vec3 &pos, const glm::vec3 &norm, const glm::vec2 &uv, const glm::vec4 &col)
-      : position(pos), normal(norm), texCoord(uv), color(col), quadric(glm::mat4(0.0f)), isDeleted(false) {}
+  int add(const glm::vec3 &pos, const glm::vec3 &norm, const glm::vec2 &uv, const glm::vec4 &col)
+  {
+    positions.push_back(pos);
+    if (hasQuadrics)
+      quadrics.push_back(Quadric());
+    normals.push_back(norm);
+    texCoords.push_back(uv);
+    colors.push_back(col);
+    deleted.push_back(0);
+    return (int)positions.size() - 1;
+  }
+
+  // quadric 배열 해제 (이후 add()도 quadric을 추가하지 않음)
+  void releaseQuadrics()
+  {
+    std::vector<Quadric>().swap(quadrics);
+    hasQuadrics = false;
+  }
+
+  // quadric 배열 (다시) 할당, 값은 zero quadric
+  void allocateQuadrics()
+  {
+    quadrics.assign(positions.size(), Quadric());
+    hasQuadrics = true;
+  }
+
+  bool isDeleted(int i) const { return deleted[i] != 0; }
+  void setDeleted(int i) { deleted[i] = 1; }
 };
 
-#endif // VERTEX_H
\ No newline at end of file
+#endif // VERTEX_H
@@ -5,6 +5,7 @@
 #include <GL/glew.h>
 #include <string>
 #include <vector>
+#include <cstdint>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -29,12 +30,14 @@ glm::vec3 calcUnitVecByMousePosition(const glm::vec2& raw, float winW, float win
 // 트랙볼 회전 계산
 glm::mat4 calcTrackball(const glm::vec2& start, const glm::vec2& cur, float winW, float winH);
 
-// GLB Loader (loads mesh and embedded texture)
+// GLB Loader (loads indexed mesh and embedded texture)
+// out_vertices / out_uvs / out_normals: unique vertex 배열, out_indices: triangle index
 bool loadGLB(
 	const char * path,
 	std::vector<glm::vec3> & out_vertices,
 	std::vector<glm::vec2> & out_uvs,
 	std::vector<glm::vec3> & out_normals,
+	std::vector<uint32_t> & out_indices,
 	GLuint * out_textureID = nullptr
 );
 
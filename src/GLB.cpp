@@ -0,0 +1,310 @@
+#include "../includes/GLB.h"
+#include <stdio.h>
+#include <string>
+#include <algorithm>
+
+// Define STB implementations before including tiny_gltf
+#define STB_IMAGE_IMPLEMENTATION
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+
+// Configure tinygltf
+#define TINYGLTF_IMPLEMENTATION
+#define TINYGLTF_NOEXCEPTION
+#define JSON_NOEXCEPTION
+#include "../lib/tinygltf/tiny_gltf.h"
+#include "../includes/GLBReader.h"
+
+// 첫 번째 embedded texture를 decode하여 out_image에 저장 (없으면 비움)
+static void decodeFirstImage(GLBReader & reader, GLBImage * out_image) {
+	if (out_image == nullptr)
+		return;
+	*out_image = GLBImage();
+	
+	const nlohmann::json& document = reader.json();
+	auto textures = document.find("textures");
+	auto images = document.find("images");
+	if (textures == document.end() || images == document.end() || textures->empty())
+		return;
+	
+	int source = (*textures)[0].value("source", -1);
+	if (source < 0 || source >= (int)images->size())
+		return;
+	
+	// GLB에 embedded된 image만 지원 (bufferView), 외부 uri는 무시
+	int viewIndex = (*images)[source].value("bufferView", -1);
+	size_t encodedSize = 0;
+	const unsigned char* encoded = reader.bufferView(viewIndex, encodedSize);
+	if (encoded == nullptr)
+		return;
+	
+	int width, height, component;
+	unsigned char* pixels = stbi_load_from_memory(encoded, (int)encodedSize, &width, &height, &component, 0);
+	if (pixels == nullptr) {
+		printf("Warn: failed to decode embedded image %d\n", source);
+		return;
+	}
+	
+	out_image->width = width;
+	out_image->height = height;
+	out_image->component = component;
+	out_image->pixels.assign(pixels, pixels + (size_t)width * height * component);
+	stbi_image_free(pixels);
+}
+
+// GLB Loader (indexed: unique vertex 배열 + index buffer)
+// GLBReader로 파일을 mmap하여 accessor view에서 출력 배열로 바로 변환 (중간 복사 없음)
+bool loadGLBIndexed(
+	const char * path,
+	std::vector<glm::vec3> & out_positions,
+	std::vector<glm::vec2> & out_uvs,
+	std::vector<glm::vec3> & out_normals,
+	std::vector<uint32_t> & out_indices,
+	GLBImage * out_image
+) {
+	printf("Loading GLB file %s...\n", path);
+	
+	GLBReader reader;
+	if (!reader.open(path)) {
+		printf("Error: %s\n", reader.error().c_str());
+		printf("Failed to parse glTF\n");
+		return false;
+	}
+	
+	const nlohmann::json& document = reader.json();
+	auto meshes = document.find("meshes");
+	if (meshes == document.end() || !meshes->is_array()) {
+		printf("Warn: GLB has no meshes\n");
+		meshes = document.end();
+	}
+	
+	// 출력 배열 크기를 미리 계산하여 한 번만 할당
+	size_t totalVertices = out_positions.size();
+	size_t totalIndices = out_indices.size();
+	
+	// Process each mesh in the glTF file
+	for (int pass = 0; pass < 2 && meshes != document.end(); pass++) {
+		if (pass == 1) {
+			out_positions.reserve(totalVertices);
+			out_normals.reserve(totalVertices);
+			out_uvs.reserve(totalVertices);
+			out_indices.reserve(totalIndices);
+		}
+		
+		for (const auto& mesh : *meshes) {
+			auto primitives = mesh.find("primitives");
+			if (primitives == mesh.end())
+				continue;
+			
+			for (const auto& primitive : *primitives) {
+				// Triangle list만 지원 (mode 기본값 4 = TRIANGLES)
+				if (primitive.value("mode", 4) != 4)
+					continue;
+				
+				auto attributes = primitive.find("attributes");
+				if (attributes == primitive.end() || !attributes->contains("POSITION"))
+					continue;
+				
+				// Get vertex positions
+				GLBAccessorView positions;
+				if (!reader.accessor(attributes->value("POSITION", -1), positions)) {
+					printf("Warn: invalid POSITION accessor, primitive skipped\n");
+					continue;
+				}
+				
+				// Get indices if available
+				GLBAccessorView indices;
+				bool indexed = primitive.contains("indices");
+				if (indexed && !reader.accessor(primitive.value("indices", -1), indices)) {
+					printf("Warn: invalid index accessor, primitive skipped\n");
+					continue;
+				}
+				
+				size_t vertexCount = positions.count;
+				size_t indexCount = indexed ? indices.count : vertexCount;
+				if (pass == 0) {
+					totalVertices += vertexCount;
+					totalIndices += indexCount;
+					continue;
+				}
+				
+				// Get normals / texture coordinates (없으면 기본값)
+				GLBAccessorView normals;
+				bool hasNormals = attributes->contains("NORMAL") &&
+					reader.accessor(attributes->value("NORMAL", -1), normals) && normals.count >= vertexCount;
+				GLBAccessorView texCoords;
+				bool hasTexCoords = attributes->contains("TEXCOORD_0") &&
+					reader.accessor(attributes->value("TEXCOORD_0", -1), texCoords) && texCoords.count >= vertexCount;
+				
+				// primitive마다 vertex 배열이 따로 있으므로 index에 offset을 더해 하나로 합침
+				const uint32_t base = (uint32_t)out_positions.size();
+				
+				// Unique vertex arrays
+				for (size_t i = 0; i < vertexCount; ++i) {
+					out_positions.push_back(positions.getVec3(i));
+					out_normals.push_back(hasNormals ? normals.getVec3(i) : glm::vec3(0.0f, 0.0f, 1.0f));
+					out_uvs.push_back(hasTexCoords ? texCoords.getVec2(i) : glm::vec2(0.0f, 0.0f));
+				}
+				
+				// Indices (없으면 0, 1, 2, ...)
+				// 파일의 index는 vertex 배열 범위를 벗어나면 out-of-bounds read가 되므로 파일 전체를 거부
+				for (size_t i = 0; i < indexCount; ++i) {
+					uint32_t index = indexed ? indices.getIndex(i) : (uint32_t)i;
+					if (index >= vertexCount) {
+						printf("Error: index %u at %zu is out of range (%zu vertices)\n", index, i, vertexCount);
+						return false;
+					}
+					out_indices.push_back(base + index);
+				}
+			}
+		}
+	}
+	
+	printf("Loaded %zu vertices, %zu indices from GLB\n", out_positions.size(), out_indices.size());
+	
+	// Decode embedded texture if available and requested
+	decodeFirstImage(reader, out_image);
+	
+	return true;
+}
+
+// GLB Loader (unrolled: index를 풀어서 corner마다 vertex 출력)
+bool loadGLBGeometry(
+	const char * path,
+	std::vector<glm::vec3> & out_vertices,
+	std::vector<glm::vec2> & out_uvs,
+	std::vector<glm::vec3> & out_normals,
+	GLBImage * out_image
+) {
+	std::vector<glm::vec3> positions;
+	std::vector<glm::vec2> uvs;
+	std::vector<glm::vec3> normals;
+	std::vector<uint32_t> indices;
+	if (!loadGLBIndexed(path, positions, uvs, normals, indices, out_image)) {
+		return false;
+	}
+	
+	// Build output arrays based on indices
+	out_vertices.reserve(out_vertices.size() + indices.size());
+	out_uvs.reserve(out_uvs.size() + indices.size());
+	out_normals.reserve(out_normals.size() + indices.size());
+	for (uint32_t idx : indices) {
+		if (idx >= positions.size()) {
+			printf("Error: index %u is out of range (%zu vertices)\n", idx, positions.size());
+			return false;
+		}
+		out_vertices.push_back(positions[idx]);
+		out_normals.push_back(normals[idx]);
+		out_uvs.push_back(uvs[idx]);
+	}
+	
+	printf("Loaded %zu vertices from GLB\n", out_vertices.size());
+	return true;
+}
+
+// buffer 끝에 data를 추가하고 bufferView / accessor 생성
+static int appendAccessor(tinygltf::Model & model, const void * data, size_t byteLength,
+                          int target, int componentType, int type, size_t count) {
+	tinygltf::Buffer& buffer = model.buffers[0];
+	size_t byteOffset = buffer.data.size();
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+	buffer.data.insert(buffer.data.end(), bytes, bytes + byteLength);
+	
+	tinygltf::BufferView bufferView;
+	bufferView.buffer = 0;
+	bufferView.byteOffset = byteOffset;
+	bufferView.byteLength = byteLength;
+	bufferView.target = target;
+	model.bufferViews.push_back(bufferView);
+	
+	tinygltf::Accessor accessor;
+	accessor.bufferView = (int)model.bufferViews.size() - 1;
+	accessor.byteOffset = 0;
+	accessor.componentType = componentType;
+	accessor.type = type;
+	accessor.count = count;
+	model.accessors.push_back(accessor);
+	return (int)model.accessors.size() - 1;
+}
+
+// GLB Writer (live faces / vertices only, tinygltf)
+bool saveGLB(const char * path, const Mesh & mesh) {
+	printf("Saving GLB file %s...\n", path);
+	
+	// Compact: live face가 참조하는 vertex만 새 인덱스로 remap
+	std::vector<int> remap(mesh.vertices.size(), -1);
+	std::vector<glm::vec3> positions;
+	std::vector<glm::vec3> normals;
+	std::vector<glm::vec2> uvs;
+	std::vector<unsigned int> indices;
+	indices.reserve(mesh.liveFaceCount() * 3);
+	
+	for (const Face& face : mesh.faces) {
+		if (face.isDeleted)
+			continue;
+		
+		for (int v : {face.v1, face.v2, face.v3}) {
+			if (remap[v] < 0) {
+				remap[v] = (int)positions.size();
+				positions.push_back(mesh.vertices.positions[v]);
+				normals.push_back(mesh.vertices.normals[v]);
+				uvs.push_back(mesh.vertices.texCoords[v]);
+			}
+			indices.push_back((unsigned int)remap[v]);
+		}
+	}
+	
+	if (indices.empty()) {
+		printf("Error: mesh has no faces to save\n");
+		return false;
+	}
+	
+	tinygltf::Model model;
+	model.asset.version = "2.0";
+	model.asset.generator = "QEM_Simplification";
+	model.buffers.resize(1);
+	
+	tinygltf::Primitive primitive;
+	primitive.mode = TINYGLTF_MODE_TRIANGLES;
+	primitive.attributes["POSITION"] = appendAccessor(model, positions.data(), positions.size() * sizeof(glm::vec3),
+		TINYGLTF_TARGET_ARRAY_BUFFER, TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_VEC3, positions.size());
+	primitive.attributes["NORMAL"] = appendAccessor(model, normals.data(), normals.size() * sizeof(glm::vec3),
+		TINYGLTF_TARGET_ARRAY_BUFFER, TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_VEC3, normals.size());
+	primitive.attributes["TEXCOORD_0"] = appendAccessor(model, uvs.data(), uvs.size() * sizeof(glm::vec2),
+		TINYGLTF_TARGET_ARRAY_BUFFER, TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_VEC2, uvs.size());
+	primitive.indices = appendAccessor(model, indices.data(), indices.size() * sizeof(unsigned int),
+		TINYGLTF_TARGET_ELEMENT_ARRAY_BUFFER, TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT, TINYGLTF_TYPE_SCALAR, indices.size());
+	
+	// glTF spec: POSITION accessor는 min / max 필수
+	glm::vec3 minPos = positions[0];
+	glm::vec3 maxPos = positions[0];
+	for (const glm::vec3& p : positions) {
+		minPos = glm::min(minPos, p);
+		maxPos = glm::max(maxPos, p);
+	}
+	tinygltf::Accessor& positionAccessor = model.accessors[primitive.attributes["POSITION"]];
+	positionAccessor.minValues = {minPos.x, minPos.y, minPos.z};
+	positionAccessor.maxValues = {maxPos.x, maxPos.y, maxPos.z};
+	
+	tinygltf::Mesh gltfMesh;
+	gltfMesh.primitives.push_back(primitive);
+	model.meshes.push_back(gltfMesh);
+	
+	tinygltf::Node node;
+	node.mesh = 0;
+	model.nodes.push_back(node);
+	
+	tinygltf::Scene scene;
+	scene.nodes.push_back(0);
+	model.scenes.push_back(scene);
+	model.defaultScene = 0;
+	
+	tinygltf::TinyGLTF writer;
+	bool ret = writer.WriteGltfSceneToFile(&model, path, true, true, false, true);
+	if (!ret) {
+		printf("Failed to write GLB\n");
+		return false;
+	}
+	
+	printf("Saved %zu vertices, %zu faces to GLB\n", positions.size(), indices.size() / 3);
+	return true;
+}
@@ -0,0 +1,364 @@
+#include "../includes/GLBReader.h"
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// GLB header / chunk 상수
+static const uint32_t GLB_MAGIC = 0x46546C67;      // "glTF"
+static const uint32_t GLB_CHUNK_JSON = 0x4E4F534A; // "JSON"
+static const uint32_t GLB_CHUNK_BIN = 0x004E4942;  // "BIN\0"
+static const size_t GLB_HEADER_SIZE = 12;
+static const size_t GLB_CHUNK_HEADER_SIZE = 8;
+
+// -----------------------------------------------------------------------------
+// MappedFile
+// -----------------------------------------------------------------------------
+
+bool MappedFile::open(const char *path)
+{
+	close();
+
+#ifdef _WIN32
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+	                          FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mapping == nullptr)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (view == nullptr)
+	{
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return false;
+	}
+
+	fileHandle = file;
+	mappingHandle = mapping;
+	mappedData = static_cast<const unsigned char *>(view);
+	mappedSize = (size_t)fileSize.QuadPart;
+#else
+	int fd = ::open(path, O_RDONLY);
+	if (fd < 0)
+		return false;
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size == 0)
+	{
+		::close(fd);
+		return false;
+	}
+
+	void *view = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd); // mapping은 fd를 닫아도 유지됨
+	if (view == MAP_FAILED)
+		return false;
+
+	mappedData = static_cast<const unsigned char *>(view);
+	mappedSize = (size_t)st.st_size;
+#endif
+	return true;
+}
+
+void MappedFile::close()
+{
+	if (mappedData == nullptr)
+		return;
+
+#ifdef _WIN32
+	UnmapViewOfFile(mappedData);
+	CloseHandle((HANDLE)mappingHandle);
+	CloseHandle((HANDLE)fileHandle);
+	fileHandle = nullptr;
+	mappingHandle = nullptr;
+#else
+	munmap(const_cast<unsigned char *>(mappedData), mappedSize);
+#endif
+	mappedData = nullptr;
+	mappedSize = 0;
+}
+
+// -----------------------------------------------------------------------------
+// GLBAccessorView
+// -----------------------------------------------------------------------------
+
+// 정렬되지 않은 위치에서 T 읽기 (byteStride가 4의 배수가 아닐 수 있음)
+template <typename T>
+static T readUnaligned(const unsigned char *p)
+{
+	T value;
+	memcpy(&value, p, sizeof(T));
+	return value;
+}
+
+static int componentSize(int componentType)
+{
+	switch (componentType)
+	{
+	case GLB_COMPONENT_BYTE:
+	case GLB_COMPONENT_UNSIGNED_BYTE:
+		return 1;
+	case GLB_COMPONENT_SHORT:
+	case GLB_COMPONENT_UNSIGNED_SHORT:
+		return 2;
+	case GLB_COMPONENT_UNSIGNED_INT:
+	case GLB_COMPONENT_FLOAT:
+		return 4;
+	default:
+		return 0;
+	}
+}
+
+static int componentCount(const std::string &type)
+{
+	if (type == "SCALAR")
+		return 1;
+	if (type == "VEC2")
+		return 2;
+	if (type == "VEC3")
+		return 3;
+	if (type == "VEC4")
+		return 4;
+	return 0;
+}
+
+float GLBAccessorView::getFloat(size_t i, int c) const
+{
+	if (data == nullptr || c >= components)
+		return 0.f;
+
+	const unsigned char *p = data + i * stride + (size_t)c * componentSize(componentType);
+	switch (componentType)
+	{
+	case GLB_COMPONENT_FLOAT:
+		return readUnaligned<float>(p);
+	case GLB_COMPONENT_UNSIGNED_BYTE:
+		return normalized ? *p / 255.f : (float)*p;
+	case GLB_COMPONENT_BYTE:
+	{
+		float value = (float)(int8_t)*p;
+		return normalized ? std::max(value / 127.f, -1.f) : value;
+	}
+	case GLB_COMPONENT_UNSIGNED_SHORT:
+	{
+		float value = (float)readUnaligned<uint16_t>(p);
+		return normalized ? value / 65535.f : value;
+	}
+	case GLB_COMPONENT_SHORT:
+	{
+		float value = (float)readUnaligned<int16_t>(p);
+		return normalized ? std::max(value / 32767.f, -1.f) : value;
+	}
+	case GLB_COMPONENT_UNSIGNED_INT:
+		return (float)readUnaligned<uint32_t>(p);
+	default:
+		return 0.f;
+	}
+}
+
+uint32_t GLBAccessorView::getIndex(size_t i) const
+{
+	if (data == nullptr)
+		return 0;
+
+	const unsigned char *p = data + i * stride;
+	switch (componentType)
+	{
+	case GLB_COMPONENT_UNSIGNED_BYTE:
+		return *p;
+	case GLB_COMPONENT_UNSIGNED_SHORT:
+		return readUnaligned<uint16_t>(p);
+	case GLB_COMPONENT_UNSIGNED_INT:
+		return readUnaligned<uint32_t>(p);
+	default:
+		return 0;
+	}
+}
+
+// -----------------------------------------------------------------------------
+// GLBReader
+// -----------------------------------------------------------------------------
+
+// JSON object의 정수 field (없거나 타입이 다르면 fallback)
+static size_t getSize(const nlohmann::json &object, const char *key, size_t fallback)
+{
+	auto it = object.find(key);
+	if (it == object.end() || !it->is_number_unsigned())
+		return fallback;
+	return it->get<size_t>();
+}
+
+bool GLBReader::open(const char *path)
+{
+	document = nlohmann::json();
+	bin = nullptr;
+	binSize = 0;
+	errorMessage.clear();
+
+	if (!file.open(path))
+	{
+		errorMessage = "cannot map file";
+		return false;
+	}
+
+	const unsigned char *data = file.data();
+	size_t size = file.size();
+
+	// Header: magic, version, length
+	if (size < GLB_HEADER_SIZE + GLB_CHUNK_HEADER_SIZE || readUnaligned<uint32_t>(data) != GLB_MAGIC)
+	{
+		errorMessage = "not a GLB file";
+		return false;
+	}
+	if (readUnaligned<uint32_t>(data + 4) != 2)
+	{
+		errorMessage = "unsupported GLB version";
+		return false;
+	}
+	size_t totalLength = std::min<size_t>(readUnaligned<uint32_t>(data + 8), size);
+
+	// Chunks: JSON (필수, 첫 번째) + BIN (선택)
+	size_t offset = GLB_HEADER_SIZE;
+	bool hasJson = false;
+	while (offset + GLB_CHUNK_HEADER_SIZE <= totalLength)
+	{
+		size_t chunkLength = readUnaligned<uint32_t>(data + offset);
+		uint32_t chunkType = readUnaligned<uint32_t>(data + offset + 4);
+		const unsigned char *chunkData = data + offset + GLB_CHUNK_HEADER_SIZE;
+		if (chunkLength > totalLength - offset - GLB_CHUNK_HEADER_SIZE)
+		{
+			errorMessage = "truncated chunk";
+			return false;
+		}
+
+		if (chunkType == GLB_CHUNK_JSON && !hasJson)
+		{
+			// allow_exceptions = false: 실패 시 discarded 값 반환
+			document = nlohmann::json::parse(chunkData, chunkData + chunkLength, nullptr, false);
+			if (document.is_discarded() || !document.is_object())
+			{
+				errorMessage = "invalid JSON chunk";
+				return false;
+			}
+			hasJson = true;
+		}
+		else if (chunkType == GLB_CHUNK_BIN && bin == nullptr)
+		{
+			bin = chunkData;
+			binSize = chunkLength;
+		}
+
+		offset += GLB_CHUNK_HEADER_SIZE + ((chunkLength + 3) & ~(size_t)3); // 4-byte padding
+	}
+
+	if (!hasJson)
+	{
+		errorMessage = "missing JSON chunk";
+		return false;
+	}
+	return true;
+}
+
+const unsigned char *GLBReader::bufferView(int index, size_t &out_size)
+{
+	out_size = 0;
+	auto views = document.find("bufferViews");
+	if (views == document.end() || !views->is_array() || index < 0 || index >= (int)views->size())
+		return nullptr;
+
+	const nlohmann::json &view = (*views)[index];
+	// GLB의 BIN chunk는 buffer 0 (외부 uri buffer는 지원하지 않음)
+	if (getSize(view, "buffer", 0) != 0 || bin == nullptr)
+		return nullptr;
+
+	size_t byteOffset = getSize(view, "byteOffset", 0);
+	size_t byteLength = getSize(view, "byteLength", 0);
+	if (byteOffset > binSize || byteLength > binSize - byteOffset)
+		return nullptr;
+
+	out_size = byteLength;
+	return bin + byteOffset;
+}
+
+bool GLBReader::accessor(int index, GLBAccessorView &out_view)
+{
+	out_view = GLBAccessorView();
+	auto accessors = document.find("accessors");
+	if (accessors == document.end() || !accessors->is_array() || index < 0 || index >= (int)accessors->size())
+		return false;
+
+	const nlohmann::json &accessor = (*accessors)[index];
+	if (accessor.contains("sparse"))
+	{
+		printf("GLBReader: sparse accessor %d is not supported\n", index);
+		return false;
+	}
+
+	out_view.count = getSize(accessor, "count", 0);
+	out_view.componentType = (int)getSize(accessor, "componentType", 0);
+	out_view.components = componentCount(accessor.value("type", std::string()));
+	out_view.normalized = accessor.value("normalized", false);
+
+	int elementSize = componentSize(out_view.componentType) * out_view.components;
+	if (elementSize == 0)
+		return false;
+
+	// bufferView가 없으면 모든 값이 0
+	if (!accessor.contains("bufferView"))
+	{
+		out_view.stride = elementSize;
+		return true;
+	}
+
+	int viewIndex = (int)getSize(accessor, "bufferView", 0);
+	size_t viewSize = 0;
+	const unsigned char *viewData = bufferView(viewIndex, viewSize);
+	if (viewData == nullptr)
+		return false;
+
+	out_view.stride = getSize(document["bufferViews"][viewIndex], "byteStride", 0);
+	if (out_view.stride == 0)
+		out_view.stride = elementSize;
+
+	// 마지막 원소까지 bufferView 범위 안에 있는지 확인
+	// (count / byteStride는 파일 값이므로 offset + (count - 1) * stride가 wrap되지 않게 나눗셈으로 비교)
+	size_t byteOffset = getSize(accessor, "byteOffset", 0);
+	if (out_view.count > 0)
+	{
+		if (byteOffset > viewSize || viewSize - byteOffset < (size_t)elementSize)
+			return false;
+		if (out_view.count - 1 > (viewSize - byteOffset - elementSize) / out_view.stride)
+			return false;
+	}
+
+	out_view.data = viewData + byteOffset;
+	return true;
+}
@@ -0,0 +1,130 @@
+/**
+ * ProgressiveMesh.cpp - Implementation
+ *
+ * Progressive mesh collapse log 기록 / 재생
+ */
+
+#include "../includes/ProgressiveMesh.h"
+#include <algorithm>
+
+static PMVertex readVertex(const VertexStore &vertices, int v)
+{
+  return {vertices.positions[v], vertices.texCoords[v], vertices.colors[v]};
+}
+
+bool ProgressiveMesh::begin(const Mesh &mesh)
+{
+  if (!mesh.originalVertex.empty() || !mesh.originalFace.empty())
+  {
+    printf("Error: progressive mesh log must start before the mesh is compacted\n");
+    return false;
+  }
+
+  const VertexStore &v = mesh.vertices;
+  baseVertices.resize(v.size());
+  baseNormals.assign(v.normals.begin(), v.normals.end());
+  for (size_t i = 0; i < v.size(); i++)
+    baseVertices[i] = readVertex(v, (int)i);
+
+  baseCorners.clear();
+  baseCorners.reserve(mesh.faces.size() * 3);
+  for (const Face &face : mesh.faces)
+  {
+    baseCorners.push_back((uint32_t)face.v1);
+    baseCorners.push_back((uint32_t)face.v2);
+    baseCorners.push_back((uint32_t)face.v3);
+  }
+
+  collapses.clear();
+  corners.clear();
+  return true;
+}
+
+int ProgressiveMesh::beginCollapse(const Mesh &mesh, const Edge &edge)
+{
+  PMCollapse record;
+  record.v1 = mesh.originalVertexIndex(edge.v1);
+  record.v2 = mesh.originalVertexIndex(edge.v2);
+  record.v1Before = readVertex(mesh.vertices, edge.v1);
+  record.v1After = record.v1Before;
+  record.firstCorner = (int)corners.size();
+  record.liveFaces = 0;
+
+  // v2를 참조하는 corner: collapse 후 v1을 가리키거나 (face가 degenerate이면) 삭제됨
+  for (int f : mesh.vertexFaces[edge.v2])
+  {
+    const Face &face = mesh.faces[f];
+    int k = (face.v1 == edge.v2) ? 0 : (face.v2 == edge.v2) ? 1 : 2;
+    corners.push_back(mesh.originalFaceIndex(f) * 3 + k);
+  }
+  record.cornerCount = (int)corners.size() - record.firstCorner;
+
+  collapses.push_back(record);
+  return (int)collapses.size() - 1;
+}
+
+void ProgressiveMesh::endCollapse(const Mesh &mesh, int record, int v1, int liveFaces)
+{
+  collapses[record].v1After = readVertex(mesh.vertices, v1);
+  collapses[record].liveFaces = liveFaces;
+}
+
+int ProgressiveMesh::levelForFaces(int targetFaces) const
+{
+  if (baseFaceCount() <= targetFaces)
+    return 0;
+
+  // liveFaces는 level에 따라 단조 감소
+  auto it = std::partition_point(collapses.begin(), collapses.end(),
+                                 [targetFaces](const PMCollapse &c) { return c.liveFaces > targetFaces; });
+  if (it == collapses.end())
+    return (int)collapses.size();
+  return (int)(it - collapses.begin()) + 1;
+}
+
+ProgressiveMeshCursor::ProgressiveMeshCursor(const ProgressiveMesh &log)
+    : log(log), vertices(log.baseVertices), corners(log.baseCorners)
+{
+}
+
+void ProgressiveMeshCursor::setLevel(int level)
+{
+  level = std::max(0, std::min(level, (int)log.collapses.size()));
+
+  // 앞으로: collapse (v2 → v1)
+  while (current < level)
+  {
+    const PMCollapse &c = log.collapses[current++];
+    for (int i = 0; i < c.cornerCount; i++)
+      corners[log.corners[c.firstCorner + i]] = (uint32_t)c.v1;
+    vertices[c.v1] = c.v1After;
+  }
+
+  // 뒤로: vertex split (v1 → v2)
+  while (current > level)
+  {
+    const PMCollapse &c = log.collapses[--current];
+    for (int i = 0; i < c.cornerCount; i++)
+      corners[log.corners[c.firstCorner + i]] = (uint32_t)c.v2;
+    vertices[c.v1] = c.v1Before;
+  }
+}
+
+void ProgressiveMeshCursor::extract(Mesh &out) const
+{
+  out = Mesh();
+  out.vertices.releaseQuadrics();
+  out.vertices.reserve(vertices.size());
+  for (size_t i = 0; i < vertices.size(); i++)
+    out.vertices.add(vertices[i].position, log.baseNormals[i], vertices[i].texCoord, vertices[i].color);
+
+  // Degenerate (vertex가 겹친) face = 이 level에서 삭제된 face
+  out.faces.reserve(log.facesAtLevel(current));
+  for (size_t i = 0; i + 2 < corners.size(); i += 3)
+  {
+    uint32_t a = corners[i], b = corners[i + 1], c = corners[i + 2];
+    if (a == b || b == c || c == a)
+      continue;
+    out.faces.emplace_back((int)a, (int)b, (int)c, vertices[a].position, vertices[b].position, vertices[c].position);
+  }
+}
@@ -5,65 +5,315 @@
  */
 
 #include "../includes/QEM.h"
+#include "../includes/Parallel.h"
+#include "../includes/ProgressiveMesh.h"
+#include <algorithm>
 
-void computeCost(Edge &edge, const std::vector<Vertex> &vertices)
+EdgeCost computeCost(const Edge &edge, const VertexStore &vertices)
 {
   // Combine quadrics from both vertices
   // Q_edge = Q_v1 + Q_v2
-  glm::mat4 Q = vertices[edge.v1].quadric + vertices[edge.v2].quadric;
+  Quadric Q = vertices.quadrics[edge.v1] + vertices.quadrics[edge.v2];
 
-  // Compute optimal collapse position
-  // Modify last row to enforce w=1 constraint (homogeneous coordinates)
-  glm::mat4 Q_bar = Q;
-  Q_bar[0][3] = 0;                  // 첫 번째 열의 4번째 행
-  Q_bar[1][3] = 0;                  // 두 번째 열의 4번째 행
-  Q_bar[2][3] = 0;                  // 세 번째 열의 4번째 행
-  Q_bar[3][3] = 1;                  // 네 번째 열의 4번째 행
+  glm::vec3 optimalPos;
+  float minCost;
 
-  glm::vec4 optimalPos;
-  float minCost = std::numeric_limits<float>::max();
-
-  // Check if Q_bar is invertible (improved numerical stability)
-  float det = glm::determinant(Q_bar);
-  if (std::abs(det) > QEM_EPSILON)
+  // Compute optimal collapse position (A · v = -b, w=1 constraint)
+  if (Q.optimalPoint(optimalPos, QEM_CONDITION_TOLERANCE))
   {
-    // Solve linear system: Q_bar · v = [0,0,0,1]^T
-    // Result: optimal position with w=1
-    optimalPos = glm::inverse(Q_bar) * glm::vec4(0, 0, 0, 1);
-    minCost = glm::dot(optimalPos, Q * optimalPos);
+    minCost = Q.evaluate(optimalPos);
   }
   else
   {
-    // Singular matrix: try v1, v2, and midpoint, pick minimum cost
-    glm::vec3 candidates[3] = {
-        vertices[edge.v1].position,
-        vertices[edge.v2].position,
-        (vertices[edge.v1].position + vertices[edge.v2].position) * 0.5f};
+    // Ill-conditioned: minimize along the edge segment [v1, v2]
+    minCost = Q.optimalPointOnSegment(vertices.positions[edge.v1],
+                                      vertices.positions[edge.v2], optimalPos);
+  }
+
+  EdgeCost result;
+  result.optimalPosition = optimalPos;
+  result.cost = minCost;
+  return result;
+}
+
+// cos^2(MEMORYLESS_CONSTRAINT_ALPHA)
+static const double LT_COS2_ALPHA = std::pow(std::cos(glm::radians((double)MEMORYLESS_CONSTRAINT_ALPHA)), 2.0);
+
+// Lindstrom-Turk 선형 제약 조건 a · v = b 모음
+// - 우선순위 순서로 추가하고, 앞의 조건과 충분히 독립인 것만 채택 (α-compatibility)
+// - 3개가 모이면 위치가 결정됨 (이후 조건은 무시)
+struct LTConstraints
+{
+  glm::dvec3 normals[3];
+  double rhs[3];
+  int count = 0;
+
+  void add(const glm::dvec3 &a, double b)
+  {
+    double len2 = glm::dot(a, a);
+    if (count == 3 || !(len2 > 0.0))
+      return;
+
+    if (count == 1)
+    {
+      // 첫 조건과 평행하지 않아야 함
+      double d = glm::dot(normals[0], a);
+      if (d * d >= glm::dot(normals[0], normals[0]) * len2 * LT_COS2_ALPHA)
+        return;
+    }
+    else if (count == 2)
+    {
+      // 앞의 두 조건이 만드는 평면에 포함되지 않아야 함
+      glm::dvec3 n = glm::cross(normals[0], normals[1]);
+      double d = glm::dot(n, a);
+      if (d * d <= glm::dot(n, n) * len2 * (1.0 - LT_COS2_ALPHA))
+        return;
+    }
+
+    normals[count] = a;
+    rhs[count] = b;
+    count++;
+  }
+
+  // 남은 자유도 안에서 목적 함수 (gradient = H · v + g, H 대칭)를 최소화하는 조건 추가
+  // - 조건 0개: H의 행 (H · v = -g)
+  // - 조건 1개: 조건 평면 안의 두 방향 q에 대해 q · (H · v + g) = 0
+  // - 조건 2개: 남은 직선 방향 n에 대해 n · (H · v + g) = 0
+  void addFromGradient(const glm::dmat3 &H, const glm::dvec3 &g)
+  {
+    if (count == 0)
+    {
+      for (int i = 0; i < 3; i++)
+        add(H[i], -g[i]);
+    }
+    else if (count == 1)
+    {
+      glm::dvec3 a = normals[0];
+      glm::dvec3 axis = (std::abs(a.x) < std::abs(a.y))
+                            ? (std::abs(a.x) < std::abs(a.z) ? glm::dvec3(1, 0, 0) : glm::dvec3(0, 0, 1))
+                            : (std::abs(a.y) < std::abs(a.z) ? glm::dvec3(0, 1, 0) : glm::dvec3(0, 0, 1));
+      glm::dvec3 q1 = glm::normalize(glm::cross(a, axis));
+      glm::dvec3 q2 = glm::normalize(glm::cross(a, q1));
+      add(H * q1, -glm::dot(q1, g));
+      add(H * q2, -glm::dot(q2, g));
+    }
+    else if (count == 2)
+    {
+      glm::dvec3 n = glm::cross(normals[0], normals[1]);
+      add(H * n, -glm::dot(n, g));
+    }
+  }
+
+  void addFromQuadric(const Quadric &Q)
+  {
+    glm::dmat3 H(Q.a2, Q.ab, Q.ac,
+                 Q.ab, Q.b2, Q.bc,
+                 Q.ac, Q.bc, Q.c2);
+    addFromGradient(H, glm::dvec3(Q.ad, Q.bd, Q.cd));
+  }
+
+  // 조건 3개로 결정되는 점 (Cramer's rule)
+  bool solve(glm::vec3 &out) const
+  {
+    if (count < 3)
+      return false;
+
+    glm::dvec3 c12 = glm::cross(normals[1], normals[2]);
+    double det = glm::dot(normals[0], c12);
+    if (!(std::abs(det) > 0.0))
+      return false;
+
+    glm::dvec3 v = (c12 * rhs[0] + glm::cross(normals[2], normals[0]) * rhs[1] +
+                    glm::cross(normals[0], normals[1]) * rhs[2]) / det;
+    out = glm::vec3(v);
+    return std::isfinite(out.x) && std::isfinite(out.y) && std::isfinite(out.z);
+  }
+};
+
+EdgeCost computeCostMemoryless(const Edge &edge, const Mesh &mesh)
+{
+  const std::vector<glm::vec3> &positions = mesh.vertices.positions;
+
+  // v1 기준 지역 좌표로 계산: 절대 좌표에서는 d^2 항이 cost보다 훨씬 커서
+  // float 계수의 반올림 오차가 cost를 덮어버림
+  const glm::vec3 origin = positions[edge.v1];
+
+  Quadric volume;   // Σ (n · v + d)^2 = (6 · 부피)^2
+  glm::vec3 g(0.f); // Volume 보존 조건 g · v = h
+  float h = 0.f;
 
-    for (int i = 0; i < 3; i++)
+  // Volume: v1, v2에 인접한 face (둘 다 포함하는 face는 v1 쪽에서 한 번만)
+  auto addFaces = [&](int vertexIndex, int skipVertex)
+  {
+    for (int faceIdx : mesh.vertexFaces[vertexIndex])
+    {
+      const Face &face = mesh.faces[faceIdx];
+      if (face.isDeleted || face.v1 == skipVertex || face.v2 == skipVertex || face.v3 == skipVertex)
+        continue;
+
+      glm::vec3 p1 = positions[face.v1] - origin;
+      glm::vec3 n = glm::cross(positions[face.v2] - positions[face.v1], positions[face.v3] - positions[face.v1]);
+      float d = -glm::dot(n, p1);
+      volume += Quadric(glm::vec4(n, d));
+      g += n;
+      h -= d;
+    }
+  };
+  addFaces(edge.v1, -1);
+  addFaces(edge.v2, edge.v1);
+
+  // Boundary: v1, v2의 boundary edge (collapse할 edge 자신은 v1 쪽에서 한 번만)
+  // face의 winding 방향으로 a → b를 정하면 삼각형 (v, a, b)의 면적 vector는 (e × v + a × b) / 2
+  Quadric boundary;    // Σ |e × v + a × b|^2 = (2 · 쓸고 지나가는 면적)^2
+  glm::vec3 e1(0.f);   // Σ e
+  glm::vec3 e2(0.f);   // Σ a × b
+  bool hasBoundary = false;
+  auto addBoundary = [&](int vertexIndex, int skipVertex)
+  {
+    for (int edgeIdx : mesh.vertexEdges[vertexIndex])
     {
-      glm::vec4 candidate(candidates[i], 1.0f);
-      float cost = glm::dot(candidate, Q * candidate);
+      const Edge &e = mesh.edges[edgeIdx];
+      if (!e.isBoundary() || e.v1 == skipVertex || e.v2 == skipVertex)
+        continue;
 
-      if (cost < minCost)
+      // Boundary edge의 유일한 face에서 방향 확인
+      int from = -1, to = -1;
+      for (int faceIdx : mesh.vertexFaces[vertexIndex])
       {
-        minCost = cost;
-        optimalPos = candidate;
+        const Face &face = mesh.faces[faceIdx];
+        if (face.isDeleted)
+          continue;
+        int fv[3] = {face.v1, face.v2, face.v3};
+        for (int k = 0; k < 3 && from < 0; k++)
+        {
+          if ((fv[k] == e.v1 || fv[k] == e.v2) && (fv[(k + 1) % 3] == e.v1 || fv[(k + 1) % 3] == e.v2))
+          {
+            from = fv[k];
+            to = fv[(k + 1) % 3];
+          }
+        }
+        if (from >= 0)
+          break;
       }
+      if (from < 0)
+        continue;
+
+      glm::vec3 a = positions[from] - origin;
+      glm::vec3 b = positions[to] - origin;
+      boundary += Quadric::line(a, b);
+      e1 += b - a;
+      e2 += glm::cross(a, b);
+      hasBoundary = true;
+    }
+  };
+  addBoundary(edge.v1, -1);
+  addBoundary(edge.v2, edge.v1);
+
+  // Triangle shape: collapse 후 one-ring vertex까지 거리^2 합 Σ |v - p|^2 = k · |v|^2 - 2 · v · Σ p + Σ |p|^2
+  // (v1, v2 공통 이웃은 collapse 후 edge 하나: 양쪽에서 더한 뒤 v1, v2를 모두 포함하는 face의 세 번째 vertex를 뺌)
+  glm::vec3 neighborSum(0.f);
+  float neighborNorm2 = 0.f;
+  float neighborCount = 0.f;
+  auto addNeighbor = [&](int vertexIndex, float sign)
+  {
+    glm::vec3 p = positions[vertexIndex] - origin;
+    neighborSum += p * sign;
+    neighborNorm2 += glm::dot(p, p) * sign;
+    neighborCount += sign;
+  };
+  for (int vertexIndex : {edge.v1, edge.v2})
+  {
+    for (int edgeIdx : mesh.vertexEdges[vertexIndex])
+    {
+      const Edge &e = mesh.edges[edgeIdx];
+      int other = (e.v1 == vertexIndex) ? e.v2 : e.v1;
+      if (other != edge.v1 && other != edge.v2)
+        addNeighbor(other, 1.f);
     }
   }
+  for (int faceIdx : mesh.vertexFaces[edge.v1])
+  {
+    const Face &face = mesh.faces[faceIdx];
+    if (face.isDeleted || (face.v1 != edge.v2 && face.v2 != edge.v2 && face.v3 != edge.v2))
+      continue;
+    addNeighbor(face.v1 + face.v2 + face.v3 - edge.v1 - edge.v2, -1.f);
+  }
+
+  Quadric shape;
+  shape.a2 = shape.b2 = shape.c2 = neighborCount;
+  shape.ad = -neighborSum.x;
+  shape.bd = -neighborSum.y;
+  shape.cd = -neighborSum.z;
+  shape.d2 = neighborNorm2;
+
+  // Cost = w_V · 부피^2 + w_B · |edge|^2 · 면적^2 + w_S · |edge|^4 · 거리^2 (모두 길이^6 단위)
+  glm::vec3 edgeVector = positions[edge.v2] - origin;
+  float edgeLength2 = glm::dot(edgeVector, edgeVector);
+  Quadric cost = volume * (MEMORYLESS_VOLUME_WEIGHT / 36.f) +
+                 boundary * (MEMORYLESS_BOUNDARY_WEIGHT / 4.f * edgeLength2) +
+                 shape * (MEMORYLESS_SHAPE_WEIGHT * edgeLength2 * edgeLength2);
+
+  // 위치: 우선순위 순서로 선형 조건을 모아 3개가 되면 결정
+  LTConstraints constraints;
+
+  // 1. Volume 보존: 각 face가 쓸고 지나가는 부피의 합 = 0
+  constraints.add(glm::dvec3(g), (double)h);
+
+  // 2. Boundary 보존: 면적 vector 변화 e1 × v + e2 = 0 (rank 2) → |e1 × v + e2|^2 최소화
+  //    H = |e1|^2 · I - e1 · e1^T, gradient = H · v + e2 × e1
+  if (hasBoundary)
+  {
+    glm::dvec3 de1(e1);
+    glm::dmat3 H = glm::dmat3(glm::dot(de1, de1)) - glm::outerProduct(de1, de1);
+    constraints.addFromGradient(H, glm::cross(glm::dvec3(e2), de1));
+  }
 
-  // Store optimal position (vec4 → vec3)
-  edge.optimalPosition = glm::vec3(optimalPos);
+  // 3. Volume / boundary / shape 최적화: cost 자체를 최소화
+  constraints.addFromQuadric(cost);
 
-  // Store collapse cost
-  edge.cost = minCost;
+  // 4. 남은 자유도 (평면 영역 등)는 triangle shape만으로 결정 (항상 full rank)
+  constraints.addFromQuadric(shape);
+
+  EdgeCost result;
+  if (constraints.solve(result.optimalPosition))
+  {
+    result.cost = cost.evaluate(result.optimalPosition);
+  }
+  else
+  {
+    // 조건이 부족하면 (고립된 edge 등): minimize along the edge segment [v1, v2]
+    result.cost = cost.optimalPointOnSegment(glm::vec3(0.f), edgeVector, result.optimalPosition);
+  }
+  result.optimalPosition += origin;
+  return result;
 }
 
-void computeQuadric(int vertexIndex, std::vector<Vertex> &vertices, const std::vector<Face> &faces)
+EdgeCost computeEdgeCost(const Edge &edge, const Mesh &mesh)
+{
+  if (mesh.quadricUpdate == QUADRIC_MEMORYLESS)
+    return computeCostMemoryless(edge, mesh);
+  return computeCost(edge, mesh.vertices);
+}
+
+void collectStaleEdges(const Mesh &mesh, int vertexIndex, std::vector<int> &edges)
+{
+  for (int edgeIdx : mesh.vertexEdges[vertexIndex])
+  {
+    edges.push_back(edgeIdx);
+    if (mesh.quadricUpdate != QUADRIC_MEMORYLESS)
+      continue;
+
+    // Memoryless: 이웃 vertex의 face가 움직였으므로 그 vertex의 edge도 모두 갱신
+    const Edge &e = mesh.edges[edgeIdx];
+    int other = (e.v1 == vertexIndex) ? e.v2 : e.v1;
+    edges.insert(edges.end(), mesh.vertexEdges[other].begin(), mesh.vertexEdges[other].end());
+  }
+}
+
+void computeQuadric(int vertexIndex, VertexStore &vertices, const std::vector<Face> &faces)
 {
   // Initialize quadric to zero matrix
-  vertices[vertexIndex].quadric = glm::mat4(0.0f);
+  vertices.quadrics[vertexIndex] = Quadric();
 
   // Sum quadrics from all adjacent faces
   // NOTE: This is called per-vertex and iterates all faces - O(V*F) complexity
@@ -80,23 +330,20 @@ void computeQuadric(int vertexIndex, std::vector<Vertex> &vertices, const std::v
       glm::vec4 p = face.planeEquation;
 
       // Compute fundamental quadric: Kp = p · p^T (outer product)
-      // Result is 4x4 symmetric matrix
-      glm::mat4 Kp = glm::outerProduct(p, p);
+      // Result is 4x4 symmetric matrix (10 coefficients)
+      Quadric Kp(p);
 
       // Add to vertex quadric
-      vertices[vertexIndex].quadric += Kp;
+      vertices.quadrics[vertexIndex] += Kp;
     }
   }
 }
 
 // Optimized: Compute all quadrics in O(F) time instead of O(V*F)
-void computeAllQuadrics(std::vector<Vertex> &vertices, const std::vector<Face> &faces)
+void computeAllQuadrics(VertexStore &vertices, const std::vector<Face> &faces)
 {
   // Initialize all quadrics to zero
-  for (Vertex &v : vertices)
-  {
-    v.quadric = glm::mat4(0.0f);
-  }
+  std::fill(vertices.quadrics.begin(), vertices.quadrics.end(), Quadric());
 
   // Iterate faces once and accumulate to vertex quadrics
   for (const Face &face : faces)
@@ -104,77 +351,135 @@ void computeAllQuadrics(std::vector<Vertex> &vertices, const std::vector<Face> &
     if (face.isDeleted)
       continue;
 
-    // Get plane equation
-    glm::vec4 p = face.planeEquation;
-    glm::mat4 Kp = glm::outerProduct(p, p);
+    Quadric Kp(face.planeEquation);
 
     // Add to all 3 vertices of this face
-    vertices[face.v1].quadric += Kp;
-    vertices[face.v2].quadric += Kp;
-    vertices[face.v3].quadric += Kp;
+    vertices.quadrics[face.v1] += Kp;
+    vertices.quadrics[face.v2] += Kp;
+    vertices.quadrics[face.v3] += Kp;
+  }
+}
+
+// Incidence 목록에서 index 제거 (순서 무관, swap-and-pop)
+static void eraseIncidence(std::vector<int> &list, int index)
+{
+  for (size_t i = 0; i < list.size(); i++)
+  {
+    if (list[i] == index)
+    {
+      list[i] = list.back();
+      list.pop_back();
+      return;
+    }
+  }
+}
+
+void computeQuadric(int vertexIndex, Mesh &mesh)
+{
+  // Initialize quadric to zero matrix
+  mesh.vertices.quadrics[vertexIndex] = Quadric();
+
+  // Sum quadrics from incident faces only - O(valence)
+  for (int faceIdx : mesh.vertexFaces[vertexIndex])
+  {
+    const Face &face = mesh.faces[faceIdx];
+    if (face.isDeleted)
+      continue;
+
+    mesh.vertices.quadrics[vertexIndex] += Quadric(face.planeEquation);
   }
 }
 
-void edgeCollapse(Mesh &mesh, Edge &edge)
+int edgeCollapse(Mesh &mesh, Edge &edge, std::vector<int> *removedEdges, std::vector<int> *updatedEdges)
+{
+  mesh.recordCollapse(edge);
+  int record = mesh.collapseLog ? mesh.collapseLog->beginCollapse(mesh, edge) : -1;
+  int removedFaces = edgeCollapseLocal(mesh, edge, removedEdges);
+
+  // cost가 바뀐 edge 재계산 (memoryless에서는 같은 edge가 양 끝점 쪽에서 두 번 수집됨)
+  std::vector<int> staleEdges;
+  std::vector<int> &stale = updatedEdges ? *updatedEdges : staleEdges;
+  size_t first = stale.size();
+  collectStaleEdges(mesh, edge.v1, stale);
+  std::sort(stale.begin() + first, stale.end());
+  stale.erase(std::unique(stale.begin() + first, stale.end()), stale.end());
+  for (size_t i = first; i < stale.size(); i++)
+    mesh.edgeCosts[stale[i]] = computeEdgeCost(mesh.edges[stale[i]], mesh);
+
+  mesh.deletedVertices += 1;
+  mesh.deletedFaces += removedFaces;
+  if (mesh.collapseLog)
+    mesh.collapseLog->endCollapse(mesh, record, edge.v1, mesh.liveFaceCount());
+  return removedFaces;
+}
+
+int edgeCollapseLocal(Mesh &mesh, Edge &edge, std::vector<int> *removedEdges)
 {
   int v1 = edge.v1;
   int v2 = edge.v2;
-  glm::vec3 newPosition = edge.optimalPosition;
+  int collapsedEdge = (int)(&edge - mesh.edges.data());
+  glm::vec3 newPosition = mesh.edgeCosts[collapsedEdge].optimalPosition;
 
   // Step 1: vertex 통합 및 삭제
-  mesh.vertices[v1].position = newPosition;
-  mesh.vertices[v2].position = newPosition; // v2도 같은 위치로 (cleanup 전까지)
-  mesh.vertices[v2].isDeleted = true;
-  mesh.deletedVertices += 1;
+  mesh.vertices.positions[v1] = newPosition;
+  mesh.vertices.positions[v2] = newPosition; // v2도 같은 위치로 (cleanup 전까지)
+  mesh.vertices.setDeleted(v2);
 
   // Step 2: edge 삭제 표시
-  edge.isDeleted = true;
+  edge.setDeleted();
+
+  std::vector<int> &v1Edges = mesh.vertexEdges[v1];
+  std::vector<int> &v2Edges = mesh.vertexEdges[v2];
+  std::vector<int> &v1Faces = mesh.vertexFaces[v1];
+  std::vector<int> &v2Faces = mesh.vertexFaces[v2];
 
-  // Step 3: 영향받는 edge들 추적 (v1과 인접한 edge들)
-  std::unordered_set<int> affectedEdgeIndices;
+  // Step 3: collapse된 edge를 incidence에서 제거
+  eraseIncidence(v1Edges, collapsedEdge);
+  if (removedEdges)
+    removedEdges->push_back(collapsedEdge);
 
-  // Step 4: edge들 업데이트 (v2 → v1 remap)
-  for (int i = 0; i < mesh.edges.size(); i++)
+  // Step 4: v2의 edge들 업데이트 (v2 → v1 remap)
+  for (int edgeIdx : v2Edges)
   {
-    Edge &e = mesh.edges[i];
-    if (e.isDeleted)
+    Edge &e = mesh.edges[edgeIdx];
+    if (e.isDeleted())
       continue;
 
-    bool wasModified = false;
+    int other = (e.v1 == v2) ? e.v2 : e.v1;
 
-    // v2를 포함하는 edge를 v1으로 remap
-    if (e.v1 == v2)
+    // v1에 같은 반대편 vertex를 가진 edge가 이미 있으면 중복 edge → 삭제
+    bool duplicate = (other == v1);
+    for (int i = 0; i < (int)v1Edges.size() && !duplicate; i++)
     {
-      e.v1 = v1;
-      wasModified = true;
-    }
-    if (e.v2 == v2)
-    {
-      e.v2 = v1;
-      wasModified = true;
+      const Edge &existing = mesh.edges[v1Edges[i]];
+      duplicate = (existing.v1 == other || existing.v2 == other);
     }
 
-    // Degenerate edge (v1 == v2) 제거
-    if (e.v1 == e.v2)
+    if (duplicate)
     {
-      e.isDeleted = true;
+      e.setDeleted();
+      eraseIncidence(mesh.vertexEdges[other], edgeIdx);
+      if (removedEdges)
+        removedEdges->push_back(edgeIdx);
       continue;
     }
 
-    // v1과 인접한 edge 추적 (cost 재계산 대상)
-    if (e.v1 == v1 || e.v2 == v1)
-    {
-      affectedEdgeIndices.insert(i);
-    }
+    if (e.v1 == v2)
+      e.v1 = v1;
+    if (e.v2 == v2)
+      e.v2 = v1;
+    v1Edges.push_back(edgeIdx);
   }
+  std::vector<int>().swap(v2Edges);
 
-  // Step 5: face 업데이트
-  for (Face &face : mesh.faces)
+  // Step 5: v2의 face들 업데이트 (v2 → v1 remap)
+  int removedFaces = 0;
+  for (int faceIdx : v2Faces)
   {
+    Face &face = mesh.faces[faceIdx];
     if (face.isDeleted)
       continue;
 
-    // Update faces that reference v2 → v1
     if (face.v1 == v2)
       face.v1 = v1;
     if (face.v2 == v2)
@@ -182,29 +487,58 @@ void edgeCollapse(Mesh &mesh, Edge &edge)
     if (face.v3 == v2)
       face.v3 = v1;
 
-    // Degenerate face (중복된 vertex) 삭제
+    // Degenerate face (중복된 vertex) 삭제 → 남은 vertex들의 incidence에서도 제거
     if (face.v1 == face.v2 || face.v2 == face.v3 || face.v3 == face.v1)
     {
       face.isDeleted = true;
+      removedFaces++;
+      eraseIncidence(v1Faces, faceIdx);
+      if (face.v1 != v1)
+        eraseIncidence(mesh.vertexFaces[face.v1], faceIdx);
+      if (face.v2 != v1)
+        eraseIncidence(mesh.vertexFaces[face.v2], faceIdx);
+      if (face.v3 != v1)
+        eraseIncidence(mesh.vertexFaces[face.v3], faceIdx);
+      continue;
     }
-  }
 
-  // Step 6: v1의 quadric 재계산 (새로운 위치와 topology 반영)
-  computeQuadric(v1, mesh.vertices, mesh.faces);
+    v1Faces.push_back(faceIdx);
+  }
+  std::vector<int>().swap(v2Faces);
 
-  // Step 7: 영향받는 모든 edge의 cost 재계산
-  for (int edgeIdx : affectedEdgeIndices)
+  // Step 6: v1 edge의 boundary flag 갱신 (buildEdges와 같이 인접 face가 정확히 1개이면 boundary)
+  // - v2의 boundary edge가 v1의 interior edge에 병합되거나 degenerate face가 삭제되면 face 수가 바뀜
+  // - v1에 닿지 않는 edge의 face 수는 그대로
+  for (int edgeIdx : v1Edges)
   {
-    if (!mesh.edges[edgeIdx].isDeleted)
+    Edge &e = mesh.edges[edgeIdx];
+    int other = (e.v1 == v1) ? e.v2 : e.v1;
+    int faceCount = 0;
+    for (int faceIdx : v1Faces)
     {
-      computeCost(mesh.edges[edgeIdx], mesh.vertices);
+      const Face &face = mesh.faces[faceIdx];
+      if (face.v1 == other || face.v2 == other || face.v3 == other)
+        faceCount++;
     }
+    e.setBoundary(faceCount == 1);
   }
 
+  // Step 7: v1의 quadric 갱신
+  // - Accumulate: Q1 + Q2 (O(1), 원래 표면과의 거리를 계속 누적)
+  // - Recompute: v1에 남은 face들의 plane으로 다시 합산 (O(valence))
+  // - Memoryless: 저장된 quadric 없음
+  if (mesh.quadricUpdate == QUADRIC_ACCUMULATE)
+    mesh.vertices.quadrics[v1] += mesh.vertices.quadrics[v2];
+  else if (mesh.quadricUpdate == QUADRIC_RECOMPUTE)
+    computeQuadric(v1, mesh);
+
+  // (edge cost 재계산은 호출자가 필요할 때만: heap을 쓰는 엔진은 collapse 후 collectStaleEdges의
+  //  edge를 재계산, multiple-choice는 샘플링할 때 cost를 새로 계산하므로 건너뜀)
+
   // Step 8: attribute 보간 (optimal position 기반)
   // optimal position이 v1, v2 사이 어디에 있는지에 따라 가중치 계산
-  glm::vec3 v1Pos = mesh.vertices[v1].position;
-  glm::vec3 v2Pos = mesh.vertices[v2].position;
+  glm::vec3 v1Pos = mesh.vertices.positions[v1];
+  glm::vec3 v2Pos = mesh.vertices.positions[v2];
 
   // newPosition이 v1과 v2 사이에 있다고 가정하고 보간 비율 계산
   float totalDist = glm::length(v1Pos - v2Pos);
@@ -218,30 +552,33 @@ void edgeCollapse(Mesh &mesh, Edge &edge)
   }
 
   // Weighted interpolation
-  mesh.vertices[v1].texCoord = glm::mix(mesh.vertices[v1].texCoord,
-                                        mesh.vertices[v2].texCoord, t);
-  mesh.vertices[v1].color = glm::mix(mesh.vertices[v1].color,
-                                     mesh.vertices[v2].color, t);
+  mesh.vertices.texCoords[v1] = glm::mix(mesh.vertices.texCoords[v1],
+                                         mesh.vertices.texCoords[v2], t);
+  mesh.vertices.colors[v1] = glm::mix(mesh.vertices.colors[v1],
+                                      mesh.vertices.colors[v2], t);
+
+  return removedFaces;
 }
 
-void initializeQuadrics(Mesh &mesh)
+void initializeQuadrics(Mesh &mesh, int numThreads)
 {
-  for (int i = 0; i < mesh.vertices.size(); i++)
+  parallelFor(0, (int)mesh.vertices.size(), [&mesh](int i)
   {
-    if (!mesh.vertices[i].isDeleted)
+    if (!mesh.vertices.isDeleted(i))
     {
-      computeQuadric(i, mesh.vertices, mesh.faces);
+      computeQuadric(i, mesh);
     }
-  }
+  }, numThreads);
 }
 
-void initializeEdgeCosts(Mesh &mesh)
+void initializeEdgeCosts(Mesh &mesh, int numThreads)
 {
-  for (Edge &edge : mesh.edges)
+  mesh.edgeCosts.resize(mesh.edges.size());
+  parallelFor(0, (int)mesh.edges.size(), [&mesh](int i)
   {
-    if (!edge.isDeleted)
+    if (!mesh.edges[i].isDeleted())
     {
-      computeCost(edge, mesh.vertices);
+      mesh.edgeCosts[i] = computeEdgeCost(mesh.edges[i], mesh);
     }
-  }
+  }, numThreads);
 }
@@ -0,0 +1,471 @@
+/**
+ * Simplify.cpp - Implementation
+ *
+ * Greedy / parallel / multiple-choice edge collapse 엔진
+ */
+
+#include "../includes/Simplify.h"
+#include "../includes/QEM.h"
+#include "../includes/Parallel.h"
+#include "../includes/ProgressiveMesh.h"
+#include <algorithm>
+#include <random>
+#include <chrono>
+
+// 한 round의 batch 크기 상한 (live vertex 수 대비 비율)
+const int PARALLEL_BATCH_DIVISOR = 16;
+
+// batch 하나를 thread 하나가 맡을 최소 collapse 수
+const int PARALLEL_COLLAPSE_CHUNK = 256;
+
+// 시간 제한이 있을 때 엔진 호출 사이에 시계를 확인하는 간격 (collapse 수)
+const int SIMPLIFY_TIME_CHECK_INTERVAL = 4096;
+
+// compaction 판단을 위해 엔진 한 번 호출의 collapse 수를 live face 수의 1/N로 제한
+const int SIMPLIFY_COMPACT_CHECK_DIVISOR = 4;
+
+void initializeEdgeQueue(Mesh &mesh, EdgeHeap &heap, int numThreads)
+{
+  initializeEdgeCosts(mesh, numThreads);
+
+  std::vector<EdgeHeap::Entry> entries;
+  entries.reserve(mesh.edges.size());
+  for (int i = 0; i < (int)mesh.edges.size(); i++)
+  {
+    if (mesh.edges[i].isDeleted())
+      continue; // Skip deleted edges
+    entries.push_back({mesh.edgeCosts[i].cost, i});
+  }
+  heap.build(std::move(entries));
+}
+
+// collapse 이후 heap 갱신: 삭제된 edge 제거, cost가 바뀐 edge를 새 generation으로 push
+// (cost는 collapse에서 이미 재계산됨 - 여기서 다시 계산하지 않음)
+static void updateQueueAfterCollapse(const Mesh &mesh, EdgeHeap &heap, const std::vector<int> &removedEdges,
+                                     const std::vector<int> &updatedEdges)
+{
+  for (int i : removedEdges)
+    heap.remove(i);
+
+  for (int i : updatedEdges)
+    heap.update(i, mesh.edgeCosts[i].cost);
+}
+
+CollapseProgress greedySimplify(Mesh &mesh, EdgeHeap &heap, int maxCollapses, float maxCost)
+{
+  CollapseProgress progress;
+  std::vector<int> removedEdges;
+  std::vector<int> updatedEdges;
+  while (progress.collapses < maxCollapses)
+  {
+    if (heap.empty() || heap.top().cost > maxCost)
+    {
+      progress.exhausted = true;
+      progress.errorLimited = !heap.empty();
+      break;
+    }
+
+    float cost = heap.top().cost;
+    int edgeIndex = heap.pop();
+
+    // Perform edge collapse
+    removedEdges.clear();
+    updatedEdges.clear();
+    progress.removedFaces += edgeCollapse(mesh, mesh.edges[edgeIndex], &removedEdges, &updatedEdges);
+
+    updateQueueAfterCollapse(mesh, heap, removedEdges, updatedEdges);
+    progress.maxCost = std::max(progress.maxCost, cost);
+    ++progress.collapses;
+  }
+  return progress;
+}
+
+// vertex와 그 이웃 vertex들을 stamp로 표시 (이미 표시된 vertex가 있으면 false)
+static bool oneRingIsFree(const Mesh &mesh, int vertexIndex, const std::vector<int> &stamp, int round)
+{
+  if (stamp[vertexIndex] == round)
+    return false;
+  for (int edgeIdx : mesh.vertexEdges[vertexIndex])
+  {
+    const Edge &e = mesh.edges[edgeIdx];
+    int other = (e.v1 == vertexIndex) ? e.v2 : e.v1;
+    if (stamp[other] == round)
+      return false;
+  }
+  return true;
+}
+
+static void markOneRing(const Mesh &mesh, int vertexIndex, std::vector<int> &stamp, int round)
+{
+  stamp[vertexIndex] = round;
+  for (int edgeIdx : mesh.vertexEdges[vertexIndex])
+  {
+    const Edge &e = mesh.edges[edgeIdx];
+    stamp[(e.v1 == vertexIndex) ? e.v2 : e.v1] = round;
+  }
+}
+
+// batch의 edge들을 동시에 collapse하고 mesh counter / progress 갱신
+// updatedEdges: cost가 바뀐 edge의 cached cost를 재계산하고 중복 없이 기록 (heap을 쓰는 엔진만 필요)
+static void collapseBatch(Mesh &mesh, const std::vector<int> &batch,
+                          std::vector<std::vector<int>> *removedEdges, std::vector<int> *updatedEdges,
+                          int numThreads, CollapseProgress &progress)
+{
+  std::vector<int> removedFaces(batch.size(), 0);
+  if (removedEdges && removedEdges->size() < batch.size())
+    removedEdges->resize(batch.size());
+
+  // Dirty slot / collapse log 기록은 공유 목록에 쓰므로 collapse 전에 순차적으로
+  if (mesh.changes.enabled)
+  {
+    for (int edgeIndex : batch)
+      mesh.recordCollapse(mesh.edges[edgeIndex]);
+  }
+  int firstRecord = -1;
+  if (mesh.collapseLog)
+  {
+    for (int edgeIndex : batch)
+    {
+      int record = mesh.collapseLog->beginCollapse(mesh, mesh.edges[edgeIndex]);
+      if (firstRecord < 0)
+        firstRecord = record;
+    }
+  }
+
+  parallelFor(0, (int)batch.size(), [&](int i)
+  {
+    std::vector<int> *removed = nullptr;
+    if (removedEdges)
+    {
+      removed = &(*removedEdges)[i];
+      removed->clear();
+    }
+    removedFaces[i] = edgeCollapseLocal(mesh, mesh.edges[batch[i]], removed);
+  }, numThreads, PARALLEL_COLLAPSE_CHUNK);
+
+  // 모든 collapse가 끝난 뒤 cost 계산 (memoryless에서는 이웃한 collapse의 one-ring 사이에
+  // 걸친 edge가 양쪽에서 수집되므로 중복 제거 후, quadric / face는 읽기만 하므로 병렬 가능)
+  if (updatedEdges)
+  {
+    std::vector<int> &stale = *updatedEdges;
+    stale.clear();
+    for (int edgeIndex : batch)
+      collectStaleEdges(mesh, mesh.edges[edgeIndex].v1, stale);
+    std::sort(stale.begin(), stale.end());
+    stale.erase(std::unique(stale.begin(), stale.end()), stale.end());
+
+    parallelFor(0, (int)stale.size(), [&](int i)
+    {
+      mesh.edgeCosts[stale[i]] = computeEdgeCost(mesh.edges[stale[i]], mesh);
+    }, numThreads, PARALLEL_COLLAPSE_CHUNK);
+  }
+
+  for (int i = 0; i < (int)batch.size(); i++)
+  {
+    progress.removedFaces += removedFaces[i];
+    progress.maxCost = std::max(progress.maxCost, mesh.edgeCosts[batch[i]].cost);
+    mesh.deletedFaces += removedFaces[i];
+    // batch 안의 collapse는 서로 독립이므로 순서대로 적용한 중간 LOD도 유효
+    if (mesh.collapseLog)
+      mesh.collapseLog->endCollapse(mesh, firstRecord + i, mesh.edges[batch[i]].v1, mesh.liveFaceCount());
+  }
+  mesh.deletedVertices += (int)batch.size();
+  progress.collapses += (int)batch.size();
+}
+
+CollapseProgress parallelSimplify(Mesh &mesh, EdgeHeap &heap, int maxCollapses, int numThreads, float maxCost)
+{
+  CollapseProgress progress;
+  std::vector<int> stamp(mesh.vertices.size(), 0); // vertex → 선택된 round
+  std::vector<int> batch;                           // 이번 round에 collapse할 edge
+  std::vector<int> rejected;                        // one-ring 충돌로 보류된 edge
+  std::vector<std::vector<int>> removedEdges;       // batch slot별 삭제된 edge
+  std::vector<int> updatedEdges;                    // batch 전체에서 cost가 바뀐 edge
+  int round = 0;
+
+  while (progress.collapses < maxCollapses)
+  {
+    if (heap.empty() || heap.top().cost > maxCost)
+    {
+      progress.exhausted = true;
+      progress.errorLimited = !heap.empty();
+      break;
+    }
+
+    ++round;
+    int liveVertices = (int)mesh.vertices.size() - mesh.deletedVertices;
+    int batchLimit = std::min(maxCollapses - progress.collapses,
+                              std::max(1, liveVertices / PARALLEL_BATCH_DIVISOR));
+
+    // Step 1: cost 순으로 independent set 선택
+    batch.clear();
+    rejected.clear();
+    while ((int)batch.size() < batchLimit && (int)rejected.size() < batchLimit &&
+           !heap.empty() && heap.top().cost <= maxCost)
+    {
+      int edgeIndex = heap.pop();
+      const Edge &edge = mesh.edges[edgeIndex];
+      if (oneRingIsFree(mesh, edge.v1, stamp, round) && oneRingIsFree(mesh, edge.v2, stamp, round))
+      {
+        markOneRing(mesh, edge.v1, stamp, round);
+        markOneRing(mesh, edge.v2, stamp, round);
+        batch.push_back(edgeIndex);
+      }
+      else
+      {
+        rejected.push_back(edgeIndex);
+      }
+    }
+
+    // Step 2: batch를 동시에 collapse
+    collapseBatch(mesh, batch, &removedEdges, &updatedEdges, numThreads, progress);
+
+    // Step 3: heap 갱신 (보류된 edge 재삽입, 삭제 / cost 변경 반영)
+    for (int edgeIndex : rejected)
+    {
+      if (!mesh.edges[edgeIndex].isDeleted())
+        heap.update(edgeIndex, mesh.edgeCosts[edgeIndex].cost);
+    }
+    for (int i = 0; i < (int)batch.size(); i++)
+    {
+      for (int edgeIndex : removedEdges[i])
+        heap.remove(edgeIndex);
+    }
+    for (int edgeIndex : updatedEdges)
+      heap.update(edgeIndex, mesh.edgeCosts[edgeIndex].cost);
+  }
+  return progress;
+}
+
+// 그룹 하나가 live edge를 찾기 위해 시도하는 최대 샘플 수 (후보 1개당)
+const int MULTIPLE_CHOICE_MAX_ATTEMPTS = 32;
+
+CollapseProgress multipleChoiceSimplify(Mesh &mesh, int maxCollapses, uint32_t seed, int candidates,
+                                        int numThreads, float maxCost)
+{
+  struct Choice
+  {
+    int edge;      // 그룹의 최소 cost edge (-1: live edge를 찾지 못함)
+    EdgeCost cost; // 그 edge의 cost / optimal position
+  };
+
+  CollapseProgress progress;
+  std::vector<int> stamp(mesh.vertices.size(), 0);
+  std::vector<Choice> choices;
+  std::vector<int> batch;
+  int edgeCount = (int)mesh.edges.size();
+  int round = 0;
+
+  while (progress.collapses < maxCollapses)
+  {
+    // live edge를 더 이상 찾지 못했거나 모든 승자가 maxCost 초과 (아래 Step 2)
+    if (edgeCount == 0)
+    {
+      progress.exhausted = true;
+      break;
+    }
+
+    ++round;
+    int liveVertices = (int)mesh.vertices.size() - mesh.deletedVertices;
+    int groups = std::min(maxCollapses - progress.collapses,
+                          std::max(1, liveVertices / PARALLEL_BATCH_DIVISOR));
+
+    // Step 1: 그룹마다 k개 후보를 샘플링하고 최소 cost edge 선택 (mesh는 읽기 전용)
+    choices.assign(groups, {-1, EdgeCost()});
+    parallelFor(0, groups, [&](int g)
+    {
+      std::minstd_rand rng(seed ^ (uint32_t)(round * 0x9E3779B9u) ^ (uint32_t)(g * 0x85EBCA6Bu));
+      std::uniform_int_distribution<int> pick(0, edgeCount - 1);
+      Choice &best = choices[g];
+      best.cost.cost = std::numeric_limits<float>::max();
+
+      int found = 0;
+      for (int attempt = 0; found < candidates && attempt < candidates * MULTIPLE_CHOICE_MAX_ATTEMPTS; attempt++)
+      {
+        int edgeIndex = pick(rng);
+        if (mesh.edges[edgeIndex].isDeleted())
+          continue;
+        ++found;
+
+        // 다른 그룹과 같은 edge를 뽑을 수 있으므로 mesh.edgeCosts에 쓰지 않고 지역 변수에 계산
+        EdgeCost candidate = computeEdgeCost(mesh.edges[edgeIndex], mesh);
+        if (candidate.cost < best.cost.cost)
+        {
+          best.edge = edgeIndex;
+          best.cost = candidate;
+        }
+      }
+    }, numThreads, PARALLEL_COLLAPSE_CHUNK);
+
+    // Step 2: one-ring이 겹치지 않는 승자만 batch에 추가
+    batch.clear();
+    for (const Choice &choice : choices)
+    {
+      if (choice.edge < 0 || choice.cost.cost > maxCost)
+        continue;
+      const Edge &edge = mesh.edges[choice.edge];
+      if (!oneRingIsFree(mesh, edge.v1, stamp, round) || !oneRingIsFree(mesh, edge.v2, stamp, round))
+        continue;
+      markOneRing(mesh, edge.v1, stamp, round);
+      markOneRing(mesh, edge.v2, stamp, round);
+      mesh.edgeCosts[choice.edge] = choice.cost;
+      batch.push_back(choice.edge);
+    }
+
+    // live edge를 더 이상 찾지 못했거나 모든 승자가 maxCost 초과
+    // (maxCost 이하인 첫 승자는 항상 batch에 들어가므로, 비었다면 찾은 승자는 모두 초과)
+    if (batch.empty())
+    {
+      progress.exhausted = true;
+      for (const Choice &choice : choices)
+        progress.errorLimited = progress.errorLimited || choice.edge >= 0;
+      break;
+    }
+
+    // Step 3: batch를 동시에 collapse
+    // (갱신할 heap이 없으므로 삭제된 edge 목록 / cached cost 재계산은 불필요)
+    collapseBatch(mesh, batch, nullptr, nullptr, numThreads, progress);
+  }
+  return progress;
+}
+
+bool compactIfNeeded(Mesh &mesh, EdgeHeap *heap, float threshold, int numThreads)
+{
+  if (mesh.deletedFaces == 0 || mesh.deadFraction() <= threshold)
+    return false;
+
+  std::vector<int> edgeRemap;
+  mesh.compact(&edgeRemap, numThreads);
+  if (heap)
+    heap->remap(edgeRemap, mesh.edges.size());
+  return true;
+}
+
+// start 시점부터 경과 시간 (ms)
+static double elapsedMs(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+SimplifyStats simplify(Mesh &mesh, const SimplifyOptions &options)
+{
+  SimplifyStats stats;
+  auto start = std::chrono::steady_clock::now();
+  stats.initialFaces = mesh.liveFaceCount();
+
+  // 목표 face 수 (둘 다 주어지면 더 큰 값 = 먼저 도달하는 쪽)
+  int targetFaces = 0;
+  if (options.targetFaceCount > 0)
+    targetFaces = options.targetFaceCount;
+  if (options.targetRatio > 0.f)
+    targetFaces = std::max(targetFaces, (int)(options.targetRatio * stats.initialFaces));
+
+  // Phase 1: vertex quadric
+  auto phaseStart = std::chrono::steady_clock::now();
+  mesh.quadricUpdate = options.quadricUpdate;
+  if (options.quadricUpdate == QUADRIC_MEMORYLESS)
+  {
+    mesh.vertices.releaseQuadrics(); // cost를 face에서 매번 계산하므로 저장하지 않음
+  }
+  else
+  {
+    if (!mesh.vertices.hasQuadrics)
+      mesh.vertices.allocateQuadrics();
+    initializeQuadrics(mesh, options.numThreads);
+  }
+  stats.quadricTime = elapsedMs(phaseStart);
+
+  // Phase 2: edge cost + heap
+  EdgeHeap heap;
+  phaseStart = std::chrono::steady_clock::now();
+  if (options.method != MULTIPLE_CHOICE)
+    initializeEdgeQueue(mesh, heap, options.numThreads);
+  stats.queueTime = elapsedMs(phaseStart);
+
+  // Phase 3: collapse
+  phaseStart = std::chrono::steady_clock::now();
+  uint32_t seed = options.seed;
+  stats.stopReason = STOP_TARGET_REACHED;
+  while (mesh.liveFaceCount() > targetFaces)
+  {
+    if (options.timeBudget > 0.0 && elapsedMs(start) >= options.timeBudget * 1000.0)
+    {
+      stats.stopReason = STOP_TIME_BUDGET;
+      break;
+    }
+
+    // 내부 collapse는 보통 face 2개를 지우므로 남은 face 차이의 절반씩 요청
+    int collapses = std::max(1, (mesh.liveFaceCount() - targetFaces) / 2);
+    if (options.timeBudget > 0.0)
+      collapses = std::min(collapses, SIMPLIFY_TIME_CHECK_INTERVAL);
+    if (options.compactThreshold > 0.f)
+      collapses = std::min(collapses, std::max(1, mesh.liveFaceCount() / SIMPLIFY_COMPACT_CHECK_DIVISOR));
+
+    CollapseProgress progress;
+    switch (options.method)
+    {
+    case PARALLEL:
+      progress = parallelSimplify(mesh, heap, collapses, options.numThreads, options.maxError);
+      break;
+    case MULTIPLE_CHOICE:
+      progress = multipleChoiceSimplify(mesh, collapses, seed++, options.candidates,
+                                        options.numThreads, options.maxError);
+      break;
+    default:
+      progress = greedySimplify(mesh, heap, collapses, options.maxError);
+      break;
+    }
+
+    stats.collapses += progress.collapses;
+    stats.finalError = std::max(stats.finalError, progress.maxCost);
+    if (options.compactThreshold > 0.f &&
+        compactIfNeeded(mesh, &heap, options.compactThreshold, options.numThreads))
+      stats.compactions++;
+    if (progress.exhausted || progress.collapses == 0)
+    {
+      stats.stopReason = progress.errorLimited ? STOP_MAX_ERROR : STOP_EXHAUSTED;
+      break;
+    }
+  }
+  stats.collapseTime = elapsedMs(phaseStart);
+  stats.finalFaces = mesh.liveFaceCount();
+
+  return stats;
+}
+
+SimplifyStats simplifyIndexed(float *positions, size_t positionStride, int numVertices,
+                              uint32_t *indices, int numIndices, const SimplifyOptions &options)
+{
+  if (positionStride == 0)
+    positionStride = 3 * sizeof(float);
+
+  Mesh mesh;
+  mesh.buildMeshIndexed(positions, positionStride, numVertices, indices, numIndices);
+  SimplifyStats stats = simplify(mesh, options);
+
+  // 살아남은 vertex의 새 위치를 원래 slot에 기록 (compaction 후에도 originalVertex로 입력 index 복원)
+  unsigned char *base = reinterpret_cast<unsigned char *>(positions);
+  for (int i = 0; i < (int)mesh.vertices.size(); i++)
+  {
+    if (mesh.vertices.isDeleted(i))
+      continue;
+    const glm::vec3 &position = mesh.vertices.positions[i];
+    float *p = reinterpret_cast<float *>(base + (size_t)mesh.originalVertexIndex(i) * positionStride);
+    p[0] = position.x;
+    p[1] = position.y;
+    p[2] = position.z;
+  }
+
+  // 살아남은 face를 index buffer 앞쪽에 압축
+  int written = 0;
+  for (const Face &face : mesh.faces)
+  {
+    if (face.isDeleted)
+      continue;
+    indices[written++] = (uint32_t)mesh.originalVertexIndex(face.v1);
+    indices[written++] = (uint32_t)mesh.originalVertexIndex(face.v2);
+    indices[written++] = (uint32_t)mesh.originalVertexIndex(face.v3);
+  }
+
+  return stats;
+}
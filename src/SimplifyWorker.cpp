@@ -0,0 +1,269 @@
+/**
+ * SimplifyWorker.cpp - Implementation
+ *
+ * Viewer용 background simplification worker
+ */
+
+#include "../includes/SimplifyWorker.h"
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+
+// 정렬된 slot 목록 → 범위 (간격이 SNAPSHOT_RANGE_GAP 이하이면 합침)
+static void buildRanges(const std::vector<int> &slots, std::vector<SnapshotRange> &out)
+{
+  out.clear();
+  for (int slot : slots)
+  {
+    if (!out.empty() && slot - (out.back().first + out.back().count) <= SNAPSHOT_RANGE_GAP)
+      out.back().count = slot - out.back().first + 1;
+    else
+      out.push_back({slot, 1});
+  }
+}
+
+void buildSnapshot(const Mesh &mesh, const std::vector<int> *dirtyVertices,
+                   const std::vector<int> *dirtyFaces, MeshSnapshot &out)
+{
+  const VertexStore &v = mesh.vertices;
+  out.full = (dirtyVertices == nullptr || dirtyFaces == nullptr);
+  out.vertexSlots = (int)v.size();
+  out.faceSlots = (int)mesh.faces.size();
+  out.liveVertices = (int)v.size() - mesh.deletedVertices;
+
+  if (out.full)
+  {
+    out.vertexRanges.assign(1, {0, out.vertexSlots});
+    out.faceRanges.assign(1, {0, out.faceSlots});
+  }
+  else
+  {
+    buildRanges(*dirtyVertices, out.vertexRanges);
+    buildRanges(*dirtyFaces, out.faceRanges);
+  }
+
+  out.vertices.clear();
+  for (const SnapshotRange &range : out.vertexRanges)
+  {
+    for (int i = range.first; i < range.first + range.count; i++)
+    {
+      out.vertices.emplace_back();
+      out.vertices.back().set(v.positions[i], v.colors[i], v.texCoords[i]);
+    }
+  }
+
+  out.indices.clear();
+  for (const SnapshotRange &range : out.faceRanges)
+  {
+    for (int i = range.first; i < range.first + range.count; i++)
+    {
+      const Face &face = mesh.faces[i];
+      bool live = !face.isDeleted;
+      out.indices.push_back(live ? (uint32_t)face.v1 : 0u);
+      out.indices.push_back(live ? (uint32_t)face.v2 : 0u);
+      out.indices.push_back(live ? (uint32_t)face.v3 : 0u);
+    }
+  }
+}
+
+void SimplifyWorker::start(Mesh &&source, int collapsesPerStep)
+{
+  stop();
+
+  mesh = std::move(source);
+  heap.clear();
+  stepSize = std::max(1, collapsesPerStep);
+  stepsDone = 0;
+  liveFaceCount.store(mesh.liveFaceCount(), std::memory_order_relaxed);
+  mesh.changes.enable(mesh.vertices.size(), mesh.faces.size());
+
+  // 첫 snapshot은 full (thread 시작 전이므로 render thread와 경쟁 없음)
+  publishSnapshot();
+
+  stopping.store(false);
+  thread = std::thread(&SimplifyWorker::run, this);
+}
+
+void SimplifyWorker::stop()
+{
+  if (!thread.joinable())
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(wakeMutex);
+    stopping.store(true);
+  }
+  wake.notify_one();
+  thread.join();
+  pendingSteps.store(0);
+}
+
+void SimplifyWorker::requestStep()
+{
+  {
+    std::lock_guard<std::mutex> lock(wakeMutex);
+    pendingSteps.fetch_add(1);
+  }
+  wake.notify_one();
+}
+
+void SimplifyWorker::requestSlice(int targetFaces, double budgetMs)
+{
+  if (sliceRequested.load(std::memory_order_acquire))
+    return; // 이전 slice 진행 중
+
+  sliceTarget = targetFaces;
+  sliceBudgetMs = budgetMs;
+  {
+    std::lock_guard<std::mutex> lock(wakeMutex);
+    sliceRequested.store(true, std::memory_order_release);
+  }
+  wake.notify_one();
+}
+
+void SimplifyWorker::run()
+{
+  while (true)
+  {
+    {
+      std::unique_lock<std::mutex> lock(wakeMutex);
+      wake.wait(lock, [this]
+                { return stopping.load() || pendingSteps.load() > 0 || sliceRequested.load(); });
+      if (stopping.load())
+        return;
+    }
+
+    // 명시적으로 요청한 단계가 slice보다 우선
+    if (pendingSteps.load() > 0)
+    {
+      simplifyStep();
+      ++stepsDone;
+      publishSnapshot();
+      progressValue.store(0.f, std::memory_order_relaxed);
+      pendingSteps.fetch_sub(1);
+      continue;
+    }
+
+    if (simplifySlice(sliceTarget, sliceBudgetMs))
+      publishSnapshot();
+    sliceRequested.store(false, std::memory_order_release);
+  }
+}
+
+void SimplifyWorker::publishSnapshot()
+{
+  MeshChanges &changes = mesh.changes;
+
+  // 직전 snapshot을 reader가 아직 가져가지 않았으면 이번 snapshot에 덮어쓰일 수 있으므로
+  // 그 변경도 포함 (그 사이에 가져가더라도 같은 데이터를 한 번 더 올릴 뿐)
+  bool carry = snapshots.unread();
+  bool full = changes.full || (carry && publishedFull);
+  if (!full)
+  {
+    std::sort(changes.vertices.begin(), changes.vertices.end());
+    std::sort(changes.faces.begin(), changes.faces.end());
+    dirtyVertices.clear();
+    dirtyFaces.clear();
+    if (carry)
+    {
+      std::set_union(changes.vertices.begin(), changes.vertices.end(),
+                     publishedVertices.begin(), publishedVertices.end(), std::back_inserter(dirtyVertices));
+      std::set_union(changes.faces.begin(), changes.faces.end(),
+                     publishedFaces.begin(), publishedFaces.end(), std::back_inserter(dirtyFaces));
+    }
+    else
+    {
+      dirtyVertices.assign(changes.vertices.begin(), changes.vertices.end());
+      dirtyFaces.assign(changes.faces.begin(), changes.faces.end());
+    }
+    full = dirtyVertices.size() > mesh.vertices.size() * SNAPSHOT_FULL_UPLOAD_FRACTION ||
+           dirtyFaces.size() > mesh.faces.size() * SNAPSHOT_FULL_UPLOAD_FRACTION;
+  }
+
+  // 결과 게시 (render thread는 다음 frame에 가져감)
+  MeshSnapshot &next = snapshots.back();
+  buildSnapshot(mesh, full ? nullptr : &dirtyVertices, full ? nullptr : &dirtyFaces, next);
+  next.step = stepsDone;
+  snapshots.publish();
+
+  publishedFull = full;
+  if (full)
+  {
+    publishedVertices.clear();
+    publishedFaces.clear();
+  }
+  else
+  {
+    publishedVertices.swap(dirtyVertices);
+    publishedFaces.swap(dirtyFaces);
+  }
+  changes.clear();
+}
+
+void SimplifyWorker::prepareQueue(SimplifyMethod method)
+{
+  if (method == MULTIPLE_CHOICE)
+    heap.clear(); // Heap을 갱신하지 않으므로 비워두고, 다른 모드로 돌아갈 때 다시 초기화
+  else if (heap.empty())
+    initializeEdgeQueue(mesh, heap);
+}
+
+CollapseProgress SimplifyWorker::runEngine(SimplifyMethod method, int maxCollapses)
+{
+  if (method == MULTIPLE_CHOICE)
+    return multipleChoiceSimplify(mesh, maxCollapses, seed++);
+  if (method == PARALLEL)
+    return parallelSimplify(mesh, heap, maxCollapses);
+  return greedySimplify(mesh, heap, maxCollapses);
+}
+
+bool SimplifyWorker::simplifySlice(int targetFaces, double budgetMs)
+{
+  if (mesh.liveFaceCount() <= targetFaces)
+    return false;
+
+  SimplifyMethod method = (SimplifyMethod)methodValue.load(std::memory_order_relaxed);
+  prepareQueue(method);
+
+  auto start = std::chrono::steady_clock::now();
+  int done = 0;
+  while (mesh.liveFaceCount() > targetFaces)
+  {
+    // collapse 하나가 face 2개를 제거하므로 목표까지 남은 수의 절반까지만
+    int collapses = std::min(SIMPLIFY_WORKER_SLICE_CHUNK, std::max(1, (mesh.liveFaceCount() - targetFaces) / 2));
+    CollapseProgress progress = runEngine(method, collapses);
+    done += progress.collapses;
+    liveFaceCount.store(mesh.liveFaceCount(), std::memory_order_relaxed);
+    if (progress.exhausted || progress.collapses == 0)
+      break;
+
+    double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    if (elapsed >= budgetMs)
+      break;
+  }
+
+  compactIfNeeded(mesh, method == MULTIPLE_CHOICE ? nullptr : &heap);
+  return done > 0;
+}
+
+void SimplifyWorker::simplifyStep()
+{
+  SimplifyMethod method = (SimplifyMethod)methodValue.load(std::memory_order_relaxed);
+  int chunk = std::max(1, (stepSize + SIMPLIFY_WORKER_PROGRESS_CHUNKS - 1) / SIMPLIFY_WORKER_PROGRESS_CHUNKS);
+  prepareQueue(method);
+
+  int done = 0;
+  while (done < stepSize && !stopping.load(std::memory_order_relaxed))
+  {
+    int collapses = std::min(chunk, stepSize - done);
+    CollapseProgress progress = runEngine(method, collapses);
+    done += progress.collapses;
+    progressValue.store((float)done / (float)stepSize, std::memory_order_relaxed);
+    liveFaceCount.store(mesh.liveFaceCount(), std::memory_order_relaxed);
+    if (progress.exhausted || progress.collapses == 0)
+      break;
+  }
+
+  // 삭제된 face가 많아지면 compaction (snapshot 생성 등 모든 순회가 live mesh 크기에 비례)
+  compactIfNeeded(mesh, method == MULTIPLE_CHOICE ? nullptr : &heap);
+}
@@ -0,0 +1,316 @@
+/*
+ * QEM Simplification - Command-line Tool
+ *
+ * GLFW / GLEW 없이 동작하는 headless simplifier
+ * - GLB 입력 → QEM simplification → GLB 출력
+ * - CI / batch job용 (display 불필요)
+ *
+ * Usage:
+ *   QEM_Simplification_cli <input.glb> <output.glb> [options]
+ *
+ * Options:
+ *   --ratio <r>       목표 face 비율 (0~1, 기본 0.5)
+ *   --faces <n>       목표 face 수 (--ratio 대신 사용)
+ *   --max-error <e>   collapse cost 상한 (quadric error)
+ *   --time <sec>      전체 simplification 시간 제한 (초)
+ *   --threads <n>     thread 수 (0: 모든 core, 기본 0)
+ *   --method <m>      greedy | parallel | multiple-choice (기본 greedy)
+ *   --weld            위치가 같은 vertex 병합 (UV / normal seam을 닫음, 기본: index 그대로 사용)
+ *   --quadric <q>     accumulate | recompute | memoryless (collapse 후 quadric 갱신 방식, 기본 accumulate)
+ *   --lods <r,r,...>  simplification 한 번의 collapse log로 LOD를 추가 저장 (원본 face 비율,
+ *                     <output>_lod<i>.glb, --ratio / --faces 결과보다 거친 LOD는 최종 결과로 제한)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <cfloat>
+#include <glm/glm.hpp>
+#include "GLB.h"
+#include "Mesh.h"
+#include "Simplify.h"
+#include "ProgressiveMesh.h"
+#include <string>
+
+static void printUsage(const char *program)
+{
+	printf("Usage: %s <input.glb> <output.glb> [options]\n", program);
+	printf("Options:\n");
+	printf("  --ratio <r>       target face ratio (0..1, default 0.5)\n");
+	printf("  --faces <n>       target face count (overrides --ratio)\n");
+	printf("  --max-error <e>   stop when the next collapse cost exceeds e\n");
+	printf("  --time <sec>      time budget for simplification in seconds\n");
+	printf("  --threads <n>     worker threads (0: all cores, default 0)\n");
+	printf("  --method <m>      greedy | parallel | multiple-choice (default greedy)\n");
+	printf("  --weld            merge vertices at the same position (closes UV / normal seams)\n");
+	printf("  --quadric <q>     accumulate | recompute | memoryless (quadric update after a collapse, default accumulate)\n");
+	printf("  --lods <r,r,...>  also save LODs at these face ratios from the same run (<output>_lod<i>.glb)\n");
+}
+
+static bool parseMethod(const char *name, SimplifyMethod &method)
+{
+	if (strcmp(name, "greedy") == 0)
+		method = GREEDY;
+	else if (strcmp(name, "parallel") == 0)
+		method = PARALLEL;
+	else if (strcmp(name, "multiple-choice") == 0)
+		method = MULTIPLE_CHOICE;
+	else
+		return false;
+	return true;
+}
+
+static bool parseRatios(const char *list, std::vector<float> &ratios)
+{
+	ratios.clear();
+	const char *p = list;
+	while (*p)
+	{
+		char *end = nullptr;
+		float r = strtof(p, &end);
+		if (end == p || r <= 0.f || r > 1.f)
+			return false;
+		ratios.push_back(r);
+		p = (*end == ',') ? end + 1 : end;
+		if (*end != ',' && *end != '\0')
+			return false;
+	}
+	return !ratios.empty();
+}
+
+// 숫자 인자: 전체 문자열이 숫자이고 [minValue, maxValue] 안이어야 함 (minExclusive: minValue 제외)
+static bool parseNumber(const char *text, double minValue, bool minExclusive, double maxValue, double &out)
+{
+	char *end = nullptr;
+	out = strtod(text, &end);
+	if (end == text || *end != '\0' || !(out <= maxValue))
+		return false;
+	return minExclusive ? out > minValue : out >= minValue;
+}
+
+static bool parseInteger(const char *text, long minValue, long maxValue, int &out)
+{
+	char *end = nullptr;
+	long value = strtol(text, &end, 10);
+	if (end == text || *end != '\0' || value < minValue || value > maxValue)
+		return false;
+	out = (int)value;
+	return true;
+}
+
+// "out.glb" → "out_lod1.glb"
+static std::string lodPath(const char *outputPath, int lod)
+{
+	std::string path(outputPath);
+	size_t dot = path.rfind('.');
+	size_t slash = path.find_last_of("/\\");
+	if (dot == std::string::npos || (slash != std::string::npos && dot < slash))
+		dot = path.size();
+	return path.substr(0, dot) + "_lod" + std::to_string(lod) + path.substr(dot);
+}
+
+static bool parseQuadricUpdate(const char *name, QuadricUpdate &update)
+{
+	if (strcmp(name, "accumulate") == 0)
+		update = QUADRIC_ACCUMULATE;
+	else if (strcmp(name, "recompute") == 0)
+		update = QUADRIC_RECOMPUTE;
+	else if (strcmp(name, "memoryless") == 0)
+		update = QUADRIC_MEMORYLESS;
+	else
+		return false;
+	return true;
+}
+
+int main(int argc, char *argv[])
+{
+	if (argc < 3)
+	{
+		printUsage(argv[0]);
+		return 1;
+	}
+
+	const char *inputPath = argv[1];
+	const char *outputPath = argv[2];
+
+	// -------------------------------------------------------------------------
+	// 1. Parse options
+	// -------------------------------------------------------------------------
+	SimplifyOptions options;
+	options.targetRatio = 0.5f;
+	bool weld = false;
+	std::vector<float> lodRatios;
+
+	for (int i = 3; i < argc; i++)
+	{
+		const char *arg = argv[i];
+		if (strcmp(arg, "--weld") == 0)
+		{
+			weld = true;
+			continue;
+		}
+
+		const char *value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+		if (value == nullptr)
+		{
+			printf("Missing value for %s\n", arg);
+			return 1;
+		}
+
+		double number = 0.0;
+		bool valid = true;
+		if (strcmp(arg, "--ratio") == 0)
+		{
+			valid = parseNumber(value, 0.0, true, 1.0, number);
+			options.targetRatio = (float)number;
+		}
+		else if (strcmp(arg, "--faces") == 0)
+		{
+			valid = parseInteger(value, 1, INT32_MAX, options.targetFaceCount);
+			options.targetRatio = 0.f;
+		}
+		else if (strcmp(arg, "--max-error") == 0)
+		{
+			valid = parseNumber(value, 0.0, false, FLT_MAX, number);
+			options.maxError = (float)number;
+		}
+		else if (strcmp(arg, "--time") == 0)
+		{
+			valid = parseNumber(value, 0.0, true, DBL_MAX, number);
+			options.timeBudget = number;
+		}
+		else if (strcmp(arg, "--threads") == 0)
+			valid = parseInteger(value, 0, INT32_MAX, options.numThreads);
+		else if (strcmp(arg, "--method") == 0)
+		{
+			if (!parseMethod(value, options.method))
+			{
+				printf("Unknown method: %s\n", value);
+				return 1;
+			}
+		}
+		else if (strcmp(arg, "--lods") == 0)
+		{
+			if (!parseRatios(value, lodRatios))
+			{
+				printf("Invalid LOD ratio list: %s\n", value);
+				return 1;
+			}
+		}
+		else if (strcmp(arg, "--quadric") == 0)
+		{
+			if (!parseQuadricUpdate(value, options.quadricUpdate))
+			{
+				printf("Unknown quadric update: %s\n", value);
+				return 1;
+			}
+		}
+		else
+		{
+			printf("Unknown option: %s\n", arg);
+			printUsage(argv[0]);
+			return 1;
+		}
+
+		if (!valid)
+		{
+			printf("Invalid value for %s: %s\n", arg, value);
+			printUsage(argv[0]);
+			return 1;
+		}
+		i++; // consume value
+	}
+
+	// -------------------------------------------------------------------------
+	// 2. Load GLB geometry (indexed, no GL texture upload)
+	// -------------------------------------------------------------------------
+	auto loadStart = std::chrono::steady_clock::now();
+	std::vector<glm::vec3> vertices;
+	std::vector<glm::vec2> uvs;
+	std::vector<glm::vec3> normals;
+	std::vector<uint32_t> indices;
+	if (!loadGLBIndexed(inputPath, vertices, uvs, normals, indices))
+	{
+		printf("Failed to load GLB file!\n");
+		return 1;
+	}
+
+	// -------------------------------------------------------------------------
+	// 3. Build mesh data structure (Vertex, Edge, Face)
+	// -------------------------------------------------------------------------
+	Mesh mesh;
+	if (options.quadricUpdate == QUADRIC_MEMORYLESS)
+		mesh.vertices.releaseQuadrics(); // vertex quadric을 처음부터 할당하지 않음
+	mesh.buildMeshIndexed(vertices, uvs, normals, indices, weld, options.numThreads);
+	std::vector<glm::vec3>().swap(vertices); // 입력 배열은 더 이상 필요 없음
+	std::vector<glm::vec2>().swap(uvs);
+	std::vector<glm::vec3>().swap(normals);
+	std::vector<uint32_t>().swap(indices);
+	double loadTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - loadStart).count();
+	printf("Mesh: %zu vertices, %zu faces, %zu edges\n",
+				 mesh.vertices.size(), mesh.faces.size(), mesh.edges.size());
+
+	// -------------------------------------------------------------------------
+	// 4. Simplify
+	// -------------------------------------------------------------------------
+	ProgressiveMesh collapseLog;
+	if (!lodRatios.empty())
+	{
+		collapseLog.begin(mesh);
+		mesh.collapseLog = &collapseLog;
+	}
+
+	SimplifyStats stats = simplify(mesh, options);
+	mesh.collapseLog = nullptr;
+
+	const char *stopReasons[] = {"target reached", "max error", "time budget", "exhausted"};
+	printf("Simplified: %d -> %d faces (%d collapses, max error %g, %s)\n",
+				 stats.initialFaces, stats.finalFaces, stats.collapses, stats.finalError,
+				 stopReasons[stats.stopReason]);
+	printf("Time: load %.1f ms, quadrics %.1f ms, queue %.1f ms, collapse %.1f ms (%d compactions)\n",
+				 loadTime, stats.quadricTime, stats.queueTime, stats.collapseTime, stats.compactions);
+
+	// -------------------------------------------------------------------------
+	// 5. Save result (삭제된 entry를 제거한 뒤 저장)
+	// -------------------------------------------------------------------------
+	mesh.compact(nullptr, options.numThreads);
+	if (!saveGLB(outputPath, mesh))
+	{
+		printf("Failed to save GLB file!\n");
+		return 1;
+	}
+
+	// -------------------------------------------------------------------------
+	// 6. LODs (collapse log 재생, simplification 재실행 없음)
+	// -------------------------------------------------------------------------
+	if (!lodRatios.empty())
+	{
+		printf("Collapse log: %zu collapses, %.1f KB\n",
+					 collapseLog.collapses.size(), collapseLog.logBytes() / 1024.0);
+
+		ProgressiveMeshCursor cursor(collapseLog);
+		Mesh lod;
+		for (size_t i = 0; i < lodRatios.size(); i++)
+		{
+			int targetFaces = (int)(collapseLog.baseFaceCount() * lodRatios[i]);
+			int level = collapseLog.levelForFaces(targetFaces);
+			if (collapseLog.facesAtLevel(level) > targetFaces)
+				printf("Warning: LOD %zu (%d faces) is coarser than the simplified mesh, using %d faces\n",
+							 i + 1, targetFaces, collapseLog.facesAtLevel(level));
+
+			cursor.setLevel(level);
+			cursor.extract(lod);
+			std::string path = lodPath(outputPath, (int)i + 1);
+			if (!saveGLB(path.c_str(), lod))
+			{
+				printf("Failed to save LOD %zu!\n", i + 1);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
@@ -3,16 +3,7 @@
 #include <fstream>
 #include <sstream>
 #include <map>
-
-// Define STB implementations before including tiny_gltf
-#define STB_IMAGE_IMPLEMENTATION
-#define STB_IMAGE_WRITE_IMPLEMENTATION
-
-// Configure tinygltf
-#define TINYGLTF_IMPLEMENTATION
-#define TINYGLTF_NOEXCEPTION
-#define JSON_NOEXCEPTION
-#include "../lib/tinygltf/tiny_gltf.h"
+#include "GLB.h"
 
 // 셰이더 파일 읽기
 std::string readShaderFile(const char* filePath) {
@@ -110,166 +101,22 @@ glm::mat4 calcTrackball(const glm::vec2& start, const glm::vec2& cur, float winW
 	return m;
 }
 
-// GLB Loader (loads mesh and embedded texture)
+// GLB Loader (loads indexed mesh and embedded texture)
 bool loadGLB(
 	const char * path,
 	std::vector<glm::vec3> & out_vertices,
 	std::vector<glm::vec2> & out_uvs,
 	std::vector<glm::vec3> & out_normals,
+	std::vector<uint32_t> & out_indices,
 	GLuint * out_textureID
 ) {
-	printf("Loading GLB file %s...\n", path);
-	
-	tinygltf::Model model;
-	tinygltf::TinyGLTF loader;
-	std::string err;
-	std::string warn;
-	
-	bool ret = loader.LoadBinaryFromFile(&model, &err, &warn, path);
-	
-	if (!warn.empty()) {
-		printf("Warn: %s\n", warn.c_str());
-	}
-	
-	if (!err.empty()) {
-		printf("Error: %s\n", err.c_str());
-	}
-	
-	if (!ret) {
-		printf("Failed to parse glTF\n");
+	GLBImage image;
+	if (!loadGLBIndexed(path, out_vertices, out_uvs, out_normals, out_indices, out_textureID ? &image : nullptr)) {
 		return false;
 	}
 	
-	// Process each mesh in the glTF file
-	for (const auto& mesh : model.meshes) {
-		for (const auto& primitive : mesh.primitives) {
-			// Get vertex positions
-			if (primitive.attributes.find("POSITION") != primitive.attributes.end()) {
-				const tinygltf::Accessor& accessor = model.accessors[primitive.attributes.at("POSITION")];
-				const tinygltf::BufferView& bufferView = model.bufferViews[accessor.bufferView];
-				const tinygltf::Buffer& buffer = model.buffers[bufferView.buffer];
-				
-				const float* positions = reinterpret_cast<const float*>(
-					&buffer.data[bufferView.byteOffset + accessor.byteOffset]);
-				
-				size_t vertexCount = accessor.count;
-				
-				// Get indices if available
-				std::vector<unsigned int> indices;
-				if (primitive.indices >= 0) {
-					const tinygltf::Accessor& indexAccessor = model.accessors[primitive.indices];
-					const tinygltf::BufferView& indexBufferView = model.bufferViews[indexAccessor.bufferView];
-					const tinygltf::Buffer& indexBuffer = model.buffers[indexBufferView.buffer];
-					
-					if (indexAccessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT) {
-						const unsigned short* indexData = reinterpret_cast<const unsigned short*>(
-							&indexBuffer.data[indexBufferView.byteOffset + indexAccessor.byteOffset]);
-						for (size_t i = 0; i < indexAccessor.count; ++i) {
-							indices.push_back(indexData[i]);
-						}
-					} else if (indexAccessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT) {
-						const unsigned int* indexData = reinterpret_cast<const unsigned int*>(
-							&indexBuffer.data[indexBufferView.byteOffset + indexAccessor.byteOffset]);
-						for (size_t i = 0; i < indexAccessor.count; ++i) {
-							indices.push_back(indexData[i]);
-						}
-					}
-				}
-				
-				// Get normals
-				const float* normals = nullptr;
-				if (primitive.attributes.find("NORMAL") != primitive.attributes.end()) {
-					const tinygltf::Accessor& normalAccessor = model.accessors[primitive.attributes.at("NORMAL")];
-					const tinygltf::BufferView& normalBufferView = model.bufferViews[normalAccessor.bufferView];
-					const tinygltf::Buffer& normalBuffer = model.buffers[normalBufferView.buffer];
-					normals = reinterpret_cast<const float*>(
-						&normalBuffer.data[normalBufferView.byteOffset + normalAccessor.byteOffset]);
-				}
-				
-				// Get texture coordinates
-				const float* texCoords = nullptr;
-				if (primitive.attributes.find("TEXCOORD_0") != primitive.attributes.end()) {
-					const tinygltf::Accessor& texCoordAccessor = model.accessors[primitive.attributes.at("TEXCOORD_0")];
-					const tinygltf::BufferView& texCoordBufferView = model.bufferViews[texCoordAccessor.bufferView];
-					const tinygltf::Buffer& texCoordBuffer = model.buffers[texCoordBufferView.buffer];
-					texCoords = reinterpret_cast<const float*>(
-						&texCoordBuffer.data[texCoordBufferView.byteOffset + texCoordAccessor.byteOffset]);
-				}
-				
-				// Build output arrays based on indices
-				if (!indices.empty()) {
-					for (unsigned int idx : indices) {
-						// Position
-						out_vertices.push_back(glm::vec3(
-							positions[idx * 3 + 0],
-							positions[idx * 3 + 1],
-							positions[idx * 3 + 2]
-						));
-						
-						// Normal
-						if (normals) {
-							out_normals.push_back(glm::vec3(
-								normals[idx * 3 + 0],
-								normals[idx * 3 + 1],
-								normals[idx * 3 + 2]
-							));
-						} else {
-							out_normals.push_back(glm::vec3(0.0f, 0.0f, 1.0f));
-						}
-						
-						// Texture coordinates
-						if (texCoords) {
-							out_uvs.push_back(glm::vec2(
-								texCoords[idx * 2 + 0],
-								texCoords[idx * 2 + 1]
-							));
-						} else {
-							out_uvs.push_back(glm::vec2(0.0f, 0.0f));
-						}
-					}
-				} else {
-					// No indices, use direct vertex access
-					for (size_t i = 0; i < vertexCount; ++i) {
-						// Position
-						out_vertices.push_back(glm::vec3(
-							positions[i * 3 + 0],
-							positions[i * 3 + 1],
-							positions[i * 3 + 2]
-						));
-						
-						// Normal
-						if (normals) {
-							out_normals.push_back(glm::vec3(
-								normals[i * 3 + 0],
-								normals[i * 3 + 1],
-								normals[i * 3 + 2]
-							));
-						} else {
-							out_normals.push_back(glm::vec3(0.0f, 0.0f, 1.0f));
-						}
-						
-						// Texture coordinates
-						if (texCoords) {
-							out_uvs.push_back(glm::vec2(
-								texCoords[i * 2 + 0],
-								texCoords[i * 2 + 1]
-							));
-						} else {
-							out_uvs.push_back(glm::vec2(0.0f, 0.0f));
-						}
-					}
-				}
-			}
-		}
-	}
-	
-	printf("Loaded %zu vertices from GLB\n", out_vertices.size());
-	
-	// Load embedded texture if available and requested
-	if (out_textureID != nullptr && !model.textures.empty() && !model.images.empty()) {
-		const tinygltf::Texture& tex = model.textures[0];
-		const tinygltf::Image& image = model.images[tex.source];
-		
+	// Upload embedded texture if available and requested
+	if (out_textureID != nullptr && !image.pixels.empty()) {
 		printf("Loading embedded texture: %dx%d, %d channels\n", 
 		       image.width, image.height, image.component);
 		
@@ -287,7 +134,7 @@ bool loadGLB(
 			format = GL_RGBA;
 		
 		glTexImage2D(GL_TEXTURE_2D, 0, format, image.width, image.height, 
-		             0, format, GL_UNSIGNED_BYTE, image.image.data());
+		             0, format, GL_UNSIGNED_BYTE, image.pixels.data());
 		glGenerateMipmap(GL_TEXTURE_2D);
 		
 		// Set texture parameters
@@ -5,12 +5,13 @@
  * Quadric Error Metric (QEM) 기반 메시 단순화 애플리케이션
  * - GLB 파일 로딩 및 렌더링 (embedded texture 지원)
  * - Trackball 카메라 컨트롤
- * - QEM 알고리즘을 통한 메시 단순화
+ * - QEM 알고리즘을 통한 메시 단순화 (background worker thread, 렌더 루프는 멈추지 않음)
  */
 
 #define GLM_ENABLE_EXPERIMENTAL
 #include <stdio.h>
 #include <string.h>
+#include <stddef.h>
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
 #include <glm/glm.hpp>
@@ -23,9 +24,9 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include "common.h"
 #include "Mesh.h"
-#include <map>
-#include <queue>
 #include "QEM.h"
+#include "Simplify.h"
+#include "SimplifyWorker.h"
 
 // =============================================================================
 // Global Variables
@@ -40,13 +41,17 @@ float aspectRatio = (float)WIN_W / (float)WIN_H;
 GLFWwindow *window;
 
 // Mesh Data
-Mesh mesh;										// Main mesh data structure (vertices, edges, faces)
-int simplificationLevel = 0;	// Current simplification level (for testing)
+SimplifyWorker simplifier;		// Background simplification (mesh 사본을 소유, snapshot으로 결과 전달)
 size_t activeVertexCount = 0; // Number of active (non-deleted) vertices for rendering
 
 // OpenGL Resources
 GLuint vao;				// Vertex Array Object
-GLuint vbo;				// Vertex Buffer Object
+GLuint vbo;				// Vertex Buffer Object (interleaved RenderVertex)
+GLuint ebo;				// Element Buffer Object (live face index)
+size_t vboCapacity = 0; // 현재 할당된 VBO 크기 (bytes)
+size_t eboCapacity = 0; // 현재 할당된 EBO 크기 (bytes)
+GLsizei indexCount = 0; // 그릴 index 수 (face slot * 3, 삭제된 face는 degenerate)
+size_t uploadBytes = 0;	// 마지막 snapshot의 업로드 크기 (bytes)
 GLuint textureID; // Texture ID for mesh rendering
 GLuint programID; // Shader program ID
 
@@ -86,6 +91,13 @@ glm::mat4 matProj = glm::mat4(1.f);	 // Projection matrix
 GLfloat color[4] = {0.933f, 0.769f, 0.898f, 1.0f};
 
 unsigned int originalVertexCount = 0; // Original vertex count (for tracking simplification progress)
+int originalFaceCount = 0;						// Original face count (interactive 모드 목표 계산용)
+
+// Interactive simplification (I key): 매 frame 최대 INTERACTIVE_BUDGET_MS 동안 collapse
+const double INTERACTIVE_BUDGET_MS = 4.0;				// frame당 collapse 시간 제한 (60 Hz frame의 1/4)
+const float INTERACTIVE_TARGET_RATIO = 0.1f;		// 목표 face 수 = originalFaceCount * ratio
+bool interactiveSimplify = false;
+int interactiveTarget = 0;
 
 // =============================================================================
 // Callback Functions
@@ -108,186 +120,148 @@ void DebugLog(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei le
 // =============================================================================
 
 /**
- * Update VBO with current mesh data
+ * Copy snapshot ranges into the bound buffer
+ *
+ * @param target GL_ARRAY_BUFFER / GL_ELEMENT_ARRAY_BUFFER
+ * @param ranges slot 범위 (data에 순서대로 이어붙어 있음)
+ * @param data 범위 데이터
+ * @param slotSize slot 하나의 크기 (bytes)
+ * @return 업로드한 크기 (bytes)
+ */
+size_t uploadRanges(GLenum target, const std::vector<SnapshotRange> &ranges, const void *data, size_t slotSize)
+{
+	const char *src = (const char *)data;
+	size_t uploaded = 0;
+	for (const SnapshotRange &range : ranges)
+	{
+		size_t bytes = (size_t)range.count * slotSize;
+		if (bytes == 0)
+			continue;
+		glBufferSubData(target, (GLintptr)(range.first * slotSize), bytes, src + uploaded);
+		uploaded += bytes;
+	}
+	return uploaded;
+}
+
+/**
+ * Patch VBO / EBO with a mesh snapshot
  *
- * Mesh 데이터를 GPU VBO에 업로드
- * - Simplification 후 또는 mesh 변경 시에만 호출해야 함
- * - 매 프레임 호출하면 성능 저하 발생
+ * Worker가 게시한 snapshot을 GPU에 업로드
+ * - full snapshot: buffer 크기를 맞추고 (커질 때만 glBufferData로 재할당) 전체 업로드
+ * - 그 외: 바뀐 vertex / face 범위만 glBufferSubData → 업로드 양은 collapse 수에 비례
+ * - 새 snapshot을 가져왔을 때만 호출해야 함
  *
+ * @param snapshot 렌더링할 mesh snapshot
  * @return 렌더링할 vertex 수 (삭제된 vertex 제외)
  */
-
-// Extract rendering data from mesh
-std::vector<glm::vec4> verticesVec4; // Position data (vec3 → vec4 for homogeneous coords)
-std::vector<glm::vec4> colors;			 // Vertex colors
-std::vector<glm::vec2> uvs;					 // Texture coordinates
-size_t updateRenderData()
+size_t updateRenderData(const MeshSnapshot &snapshot)
 {
-	verticesVec4.clear();
-	colors.clear();
-	uvs.clear();
-
-	// Pre-allocate memory for better performance
-	size_t estimatedSize = mesh.faces.size() * 3;
-	verticesVec4.reserve(estimatedSize);
-	colors.reserve(estimatedSize);
-	uvs.reserve(estimatedSize);
-
-	// Render based on FACES, not vertices
-	// Each face contributes 3 vertices to the rendering buffer
-	for (const Face &face : mesh.faces)
+	// Element buffer binding은 VAO에 저장되므로 VAO를 먼저 bind
+	glBindVertexArray(vao);
+	glBindBuffer(GL_ARRAY_BUFFER, vbo);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+
+	if (snapshot.full)
 	{
-		if (face.isDeleted)
-			continue; // Skip deleted faces
-
-		// Add the 3 vertices of this face
-		const Vertex &v1 = mesh.vertices[face.v1];
-		const Vertex &v2 = mesh.vertices[face.v2];
-		const Vertex &v3 = mesh.vertices[face.v3];
-
-		// Positions
-		verticesVec4.push_back(glm::vec4(v1.position, 1.0f));
-		verticesVec4.push_back(glm::vec4(v2.position, 1.0f));
-		verticesVec4.push_back(glm::vec4(v3.position, 1.0f));
-
-		// Colors
-		colors.push_back(v1.color);
-		colors.push_back(v2.color);
-		colors.push_back(v3.color);
-
-		// UVs
-		uvs.push_back(v1.texCoord);
-		uvs.push_back(v2.texCoord);
-		uvs.push_back(v3.texCoord);
+		size_t vertexSize = (size_t)snapshot.vertexSlots * sizeof(RenderVertex);
+		size_t indexSize = (size_t)snapshot.faceSlots * 3 * sizeof(uint32_t);
+		if (vertexSize > vboCapacity)
+		{
+			glBufferData(GL_ARRAY_BUFFER, vertexSize, NULL, GL_DYNAMIC_DRAW);
+			vboCapacity = vertexSize;
+		}
+		if (indexSize > eboCapacity)
+		{
+			glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexSize, NULL, GL_DYNAMIC_DRAW);
+			eboCapacity = indexSize;
+		}
 	}
 
-	// Calculate buffer sizes
-	size_t vertexSize = verticesVec4.size() * sizeof(glm::vec4);
-	size_t colorSize = colors.size() * sizeof(glm::vec4);
-	size_t uvSize = uvs.size() * sizeof(glm::vec2);
-
-	// Upload data to GPU
-	// Layout: [positions | colors | uvs]
-	glBufferData(GL_ARRAY_BUFFER, vertexSize + colorSize + uvSize, NULL, GL_STATIC_DRAW);
-	glBufferSubData(GL_ARRAY_BUFFER, 0, vertexSize, verticesVec4.data());
-	glBufferSubData(GL_ARRAY_BUFFER, vertexSize, colorSize, colors.data());
-	glBufferSubData(GL_ARRAY_BUFFER, vertexSize + colorSize, uvSize, uvs.data());
-
-	// Setup vertex attributes (match shader layout locations)
-	// Location 0: position (vec4)
-	glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 0, (void *)0);
-	glEnableVertexAttribArray(0);
-	// Location 1: color (vec4)
-	glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 0, (void *)vertexSize);
-	glEnableVertexAttribArray(1);
-	// Location 2: texCoord (vec2)
-	glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 0, (void *)(vertexSize + colorSize));
-	glEnableVertexAttribArray(2);
+	uploadBytes = uploadRanges(GL_ARRAY_BUFFER, snapshot.vertexRanges, snapshot.vertices.data(), sizeof(RenderVertex));
+	uploadBytes += uploadRanges(GL_ELEMENT_ARRAY_BUFFER, snapshot.faceRanges, snapshot.indices.data(), 3 * sizeof(uint32_t));
 
-	return verticesVec4.size(); // Return actual vertex count
+	// 삭제된 face는 degenerate (0, 0, 0)이므로 face slot 전체를 그림
+	indexCount = (GLsizei)snapshot.faceSlots * 3;
+	return (size_t)snapshot.liveVertices;
 }
 
+SimplifyMethod simplifyMode = GREEDY; // Simplification 엔진 (P key로 순환)
+
 /**
- * Edge Comparator for priority queue
- * Min-heap: 작은 cost가 우선순위가 높음 (먼저 collapse)
+ * Upload the latest simplified mesh if the worker published one
+ *
+ * 매 frame 호출: 새 snapshot이 없으면 atomic load 한 번으로 끝남
  */
-struct EdgeComparator
+void pollSimplifier()
 {
-	bool operator()(const Edge &a, const Edge &b) const
+	if (!simplifier.acquireSnapshot())
+		return;
+
+	static int lastStep = 0;
+	activeVertexCount = updateRenderData(simplifier.snapshot());
+	if (simplifier.snapshot().step != lastStep) // interactive slice는 매 frame 게시되므로 단계만 출력
 	{
-		return a.cost > b.cost; // Min-heap based on collapse cost
+		lastStep = simplifier.snapshot().step;
+		printf("Simplification step %d complete. Active vertex count: %zu (uploaded %zu bytes)\n",
+					 lastStep, activeVertexCount, uploadBytes);
 	}
-};
-
-std::priority_queue<Edge, std::vector<Edge>, EdgeComparator> edgeQueue;
+}
 
 /**
- * Mesh Simplification using QEM
+ * Drive interactive simplification
  *
- * Lazy evaluation: edge cost는 필요할 때만 재계산
- * isDirty flag로 cost가 오래되었는지 추적
- *
- * 한 번 호출 시 하나의 edge만 collapse
+ * 매 frame 호출: worker에 time slice 하나를 요청 (이전 slice가 진행 중이면 무시됨)
+ * 목표에 도달하면 interactive 모드 종료
  */
-void meshSimplify()
+void stepInteractive()
 {
-	// Initialize queue on first call (when empty)
-	if (edgeQueue.empty())
-	{
-		for (int i = 0; i < mesh.edges.size(); i++)
-		{
-			if (mesh.edges[i].isDeleted)
-				continue; // Skip deleted edges
-			computeCost(mesh.edges[i], mesh.vertices);
-			mesh.edges[i].isDirty = false;
-			edgeQueue.push(mesh.edges[i]);
-		}
-	}
+	if (!interactiveSimplify)
+		return;
 
-	int count = 0;
-	// Perform ONE edge collapse per call
-	while (!edgeQueue.empty())
+	if (simplifier.liveFaces() <= interactiveTarget)
 	{
-		Edge edge = edgeQueue.top();
-		edgeQueue.pop();
-
-		// Find the edge in mesh.edges array (to check isDirty and isDeleted)
-		int edgeIndex = -1;
-		for (int i = 0; i < mesh.edges.size(); i++)
-		{
-			// Check both directions since edge can be stored as (v1,v2) or (v2,v1)
-			if ((mesh.edges[i].v1 == edge.v1 && mesh.edges[i].v2 == edge.v2) ||
-					(mesh.edges[i].v1 == edge.v2 && mesh.edges[i].v2 == edge.v1))
-			{
-				edgeIndex = i;
-				break;
-			}
-		}
-
-		if (edgeIndex == -1 || mesh.edges[edgeIndex].isDeleted)
-		{
-			// Edge already deleted, try next one
-			continue;
-		}
-
-		// Check if cost is outdated (lazy evaluation)
-		if (mesh.edges[edgeIndex].isDirty)
-		{
-			// Recompute cost and reinsert into queue
-			computeCost(mesh.edges[edgeIndex], mesh.vertices);
-			mesh.edges[edgeIndex].isDirty = false;
-			edgeQueue.push(mesh.edges[edgeIndex]);
-			continue; // Try next edge
-		}
-
-		// Perform edge collapse
-		edgeCollapse(mesh, mesh.edges[edgeIndex]);
+		interactiveSimplify = false;
+		printf("Interactive simplification reached %d faces\n", simplifier.liveFaces());
+		return;
+	}
+	simplifier.requestSlice(interactiveTarget, INTERACTIVE_BUDGET_MS);
+}
 
-		int newVertexIndex = mesh.edges[edgeIndex].v1; // Use actual edge from mesh, not queue copy
+/**
+ * Show simplification progress in the window title
+ *
+ * title이 바뀔 때만 glfwSetWindowTitle 호출
+ */
+void updateTitle()
+{
+	static char lastTitle[160] = "";
+	const char *modeNames[] = {"greedy", "parallel", "multiple-choice"};
+	char title[160];
+
+	if (interactiveSimplify)
+		snprintf(title, sizeof(title), "QEM Mesh Simplification [%s] %d faces - interactive to %d faces",
+						 modeNames[simplifyMode], simplifier.liveFaces(), interactiveTarget);
+	else if (simplifier.pending() > 0)
+		snprintf(title, sizeof(title), "QEM Mesh Simplification [%s] %d faces - simplifying %d%% (%d queued)",
+						 modeNames[simplifyMode], simplifier.liveFaces(), (int)(simplifier.progress() * 100.f),
+						 simplifier.pending() - 1);
+	else
+		snprintf(title, sizeof(title), "QEM Mesh Simplification [%s] %d faces",
+						 modeNames[simplifyMode], simplifier.liveFaces());
 
-		// Mark affected edges as dirty and reinsert into queue
-		for (int i = 0; i < mesh.edges.size(); i++)
-		{
-			if (mesh.edges[i].isDeleted)
-				continue;
-			if (mesh.edges[i].v1 == newVertexIndex || mesh.edges[i].v2 == newVertexIndex)
-			{
-				mesh.edges[i].isDirty = true;
-				// Reinsert into queue so it gets reevaluated
-				edgeQueue.push(mesh.edges[i]);
-			}
-		}
-		++count;
-		if (count >= originalVertexCount / 100)
-			break;
+	if (strcmp(title, lastTitle) != 0)
+	{
+		glfwSetWindowTitle(window, title);
+		strcpy(lastTitle, title);
 	}
 }
+
 /**
  * Initialize OpenGL resources
  *
  * OpenGL 초기화:
  * - Shader 로딩
- * - VAO/VBO 생성
+ * - VAO/VBO/EBO 생성 및 vertex attribute 설정
  * - 초기 VBO 데이터 업로드
  * - Depth test 및 face culling 설정
  */
@@ -300,18 +274,31 @@ void initFunc()
 		printf("Shader loading failed!\n");
 		return;
 	}
-	originalVertexCount = mesh.vertices.size(); // Store original vertex count for tracking
 	// Create and bind VAO (Vertex Array Object)
 	glGenVertexArrays(1, &vao);
 	glBindVertexArray(vao);
 
-	// Create and bind VBO (Vertex Buffer Object)
+	// Create and bind VBO / EBO
 	glGenBuffers(1, &vbo);
 	glBindBuffer(GL_ARRAY_BUFFER, vbo);
+	glGenBuffers(1, &ebo);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+
+	// Setup vertex attributes (interleaved RenderVertex, match shader layout locations)
+	// Location 0: position (float3, w = 1)
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(RenderVertex), (void *)offsetof(RenderVertex, position));
+	glEnableVertexAttribArray(0);
+	// Location 1: color (normalized ubyte4)
+	glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(RenderVertex), (void *)offsetof(RenderVertex, color));
+	glEnableVertexAttribArray(1);
+	// Location 2: texCoord (half2)
+	glVertexAttribPointer(2, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(RenderVertex), (void *)offsetof(RenderVertex, texCoord));
+	glEnableVertexAttribArray(2);
 
 	// Upload initial mesh data to GPU
 	printf("Uploading mesh data to GPU...\n");
-	activeVertexCount = updateRenderData();
+	if (simplifier.acquireSnapshot())
+		activeVertexCount = updateRenderData(simplifier.snapshot());
 	printf("GPU upload complete. Active vertex count: %zu\n", activeVertexCount);
 
 	// Set clear color (sky blue background)
@@ -425,7 +412,7 @@ void drawFunc()
 
 	// Draw main viewport (full screen)
 	glViewport(0, 0, win_w, win_h);
-	glDrawArrays(GL_TRIANGLES, 0, verticesVec4.size());
+	glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, (void *)0);
 
 	// Draw mini-map viewport (top-right corner)
 	glEnable(GL_SCISSOR_TEST);
@@ -433,7 +420,7 @@ void drawFunc()
 	glViewport(map_x, map_y, map_w, map_h);
 	glClearColor(0.5f, 0.5f, 1.f, 1.f); // Bluish background for mini-map
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-	glDrawArrays(GL_TRIANGLES, 0, verticesVec4.size());
+	glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, (void *)0);
 	glScissor(0, 0, win_w, win_h);
 	glDisable(GL_SCISSOR_TEST);
 
@@ -528,7 +515,9 @@ void scrollFunc(GLFWwindow *win, double xoffset, double yoffset)
  * Controls:
  * - ESC: Exit application
  * - J/K: Increase/decrease FOV
- * - SPACE: Trigger simplification (WIP)
+ * - P: Cycle simplification mode (greedy → parallel → multiple-choice)
+ * - SPACE: Request a simplification step (background worker, 렌더 루프는 멈추지 않음)
+ * - I: Toggle interactive simplification (frame마다 시간 제한 slice, 목표 face 수까지 연속 진행)
  */
 void keyFunc(GLFWwindow *window, int key, int scancode, int action, int mods)
 {
@@ -561,14 +550,43 @@ void keyFunc(GLFWwindow *window, int key, int scancode, int action, int mods)
 		}
 		break;
 
+	case GLFW_KEY_P:
+		if (action == GLFW_PRESS)
+		{
+			// Cycle greedy → parallel → multiple-choice
+			const char *modeNames[] = {"greedy", "parallel", "multiple-choice"};
+			simplifyMode = (SimplifyMethod)((simplifyMode + 1) % 3);
+			simplifier.setMethod(simplifyMode);
+			printf("Simplification mode: %s\n", modeNames[simplifyMode]);
+		}
+		break;
+
 	case GLFW_KEY_SPACE:
 		if (action == GLFW_PRESS)
 		{
-			printf("Starting mesh simplification...\n");
-			meshSimplify();
-			activeVertexCount = updateRenderData(); // Update VBO with simplified mesh
-			printf("Simplification step complete. Active vertex count: %zu\n", activeVertexCount);
+			// 결과는 worker가 snapshot으로 게시 → pollSimplifier()가 다음 frame에 업로드
+			simplifier.requestStep();
+			printf("Simplification step requested (%d queued)\n", simplifier.pending());
 		}
+		break;
+
+	case GLFW_KEY_I:
+		if (action == GLFW_PRESS)
+		{
+			// 목표는 현재 face 수보다 작아야 함 (이미 목표 이하이면 다시 절반으로)
+			interactiveSimplify = !interactiveSimplify;
+			if (interactiveSimplify)
+			{
+				interactiveTarget = (int)(originalFaceCount * INTERACTIVE_TARGET_RATIO);
+				if (simplifier.liveFaces() <= interactiveTarget)
+					interactiveTarget = simplifier.liveFaces() / 2;
+				printf("Interactive simplification on (target %d faces, %.1f ms per frame)\n",
+							 interactiveTarget, INTERACTIVE_BUDGET_MS);
+			}
+			else
+				printf("Interactive simplification off\n");
+		}
+		break;
 
 	default:
 		break;
@@ -610,21 +628,21 @@ int main(int argc, char *arvg[])
 	std::vector<glm::vec3> vertices; // Temporary storage for GLB data
 	std::vector<glm::vec2> uvs;
 	std::vector<glm::vec3> normals;
-	int numVertices = 0;
+	std::vector<uint32_t> indices;
 
-	bool res = loadGLB("../../resource/mesh.glb", vertices, uvs, normals, &textureID);
+	bool res = loadGLB("../../resource/mesh.glb", vertices, uvs, normals, indices, &textureID);
 	if (!res)
 	{
 		printf("Failed to load GLB file!\n");
 		return -1;
 	}
-	numVertices = vertices.size();
-	printf("Loaded %d vertices\n", numVertices);
 
 	// -------------------------------------------------------------------------
 	// 3. Build mesh data structure (Vertex, Edge, Face)
 	// -------------------------------------------------------------------------
-	mesh.buildMesh(numVertices, vertices, uvs, normals);
+	// UV / normal seam에서 나뉜 vertex를 병합해야 seam을 따라 crack이 생기지 않음
+	Mesh mesh;
+	mesh.buildMeshIndexed(vertices, uvs, normals, indices, true);
 	printf("Mesh: %zu vertices, %zu faces, %zu edges\n",
 				 mesh.vertices.size(), mesh.faces.size(), mesh.edges.size());
 
@@ -632,9 +650,15 @@ int main(int argc, char *arvg[])
 	// 3.5. Initialize Quadrics for all vertices
 	// -------------------------------------------------------------------------
 	printf("Initializing quadrics for %zu vertices...\n", mesh.vertices.size());
-	computeAllQuadrics(mesh.vertices, mesh.faces);
+	initializeQuadrics(mesh);
 	printf("Quadrics initialized for all vertices\n");
 
+	// Mesh는 worker thread로 이동 (이후 render thread는 snapshot만 읽음)
+	// 한 단계 = originalVertexCount / 100 개의 edge collapse
+	originalVertexCount = mesh.vertices.size();
+	originalFaceCount = (int)mesh.faces.size();
+	simplifier.start(std::move(mesh), std::max(1u, originalVertexCount / 100));
+
 	// -------------------------------------------------------------------------
 	// 4. Check texture loading status
 	// -------------------------------------------------------------------------
@@ -662,6 +686,11 @@ int main(int argc, char *arvg[])
 		// Update per-frame data (camera, projection)
 		updateFunc();
 
+		// Worker 결과 업로드 / 진행률 표시
+		stepInteractive();
+		pollSimplifier();
+		updateTitle();
+
 		// Render scene
 		drawFunc();
 
@@ -681,6 +710,7 @@ int main(int argc, char *arvg[])
 	// -------------------------------------------------------------------------
 	// 7. Cleanup
 	// -------------------------------------------------------------------------
+	simplifier.stop();
 	glfwTerminate();
 	return 0;
 }
\ No newline at end of file